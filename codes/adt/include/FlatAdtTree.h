@@ -0,0 +1,71 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXVector.h"
+
+BeginNameSpace( ONEFLOW )
+
+//alternating digital tree kept in flat arrays: node i owns coor[ dim * i, dim * i + dim ),
+//item[ i ], and the indices of its children, -1 for an empty branch
+template < typename T, typename U >
+class HXFlatAdtTree
+{
+public:
+    typedef HXVector< T > ItemList;
+public:
+    HXFlatAdtTree( int dim = 3 );
+    HXFlatAdtTree( int dim, U * pmin, U * pmax );
+    HXFlatAdtTree( int dim, HXVector< U > & pmin, HXVector< U > & pmax );
+    ~HXFlatAdtTree();
+
+    // Reserve the storage of nNodes nodes, so a bulk insertion does not reallocate
+    void Reserve( int nNodes );
+    // Add a node with the coordinate and the data to the tree
+    void AddNode( U * coordinate, T data );
+    // Add nNodes nodes, coordinates are stored dim by dim
+    void AddNodes( U * coordinates, T * data, int nNodes );
+    // items is cleared and filled with the data of all nodes inside the region ( pmin, pmax )
+    void FindNodesInRegion( U * pmin, U * pmax, ItemList & items );
+    int  nCount() { return static_cast< int >( item.size() ); };
+    // Get the min coordinates of the tree
+    U  * GetMin() { return & pmin[ 0 ]; };
+    // Get the max coordinates of the tree
+    U  * GetMax() { return & pmax[ 0 ]; };
+protected:
+    bool IsInRegion( int iNode, U * pmin, U * pmax );
+    void FindNodesInRegion( int iNode, U * pmin, U * pmax, ItemList & items );
+protected:
+    int dim;
+    HXVector< U > pmin, pmax;
+    HXVector< U > coor;
+    HXVector< T > item;
+    HXVector< int > level;
+    HXVector< int > left;
+    HXVector< int > right;
+    //the window of the node being visited, shared by the queries
+    HXVector< U > nwmin, nwmax;
+};
+
+EndNameSpace
+
+#include "FlatAdtTree.hpp"
@@ -0,0 +1,194 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+BeginNameSpace( ONEFLOW )
+
+template < typename T, typename U >
+HXFlatAdtTree<T,U>::HXFlatAdtTree( int dim )
+{
+    this->dim = dim;
+    pmin.resize( dim, 0.0 );
+    pmax.resize( dim, 1.0 );
+    nwmin.resize( dim );
+    nwmax.resize( dim );
+}
+
+template < typename T, typename U >
+HXFlatAdtTree<T,U>::HXFlatAdtTree( int dim, U * pmin, U * pmax )
+{
+    this->dim = dim;
+    this->pmin.assign( pmin, pmin + dim );
+    this->pmax.assign( pmax, pmax + dim );
+    nwmin.resize( dim );
+    nwmax.resize( dim );
+}
+
+template < typename T, typename U >
+HXFlatAdtTree<T,U>::HXFlatAdtTree( int dim, HXVector< U > & pmin, HXVector< U > & pmax )
+{
+    this->dim = dim;
+    this->pmin.assign( pmin.begin(), pmin.begin() + dim );
+    this->pmax.assign( pmax.begin(), pmax.begin() + dim );
+    nwmin.resize( dim );
+    nwmax.resize( dim );
+}
+
+template < typename T, typename U >
+HXFlatAdtTree<T,U>::~HXFlatAdtTree()
+{
+    ;
+}
+
+template < typename T, typename U >
+void HXFlatAdtTree<T,U>::Reserve( int nNodes )
+{
+    coor.reserve( dim * nNodes );
+    item.reserve( nNodes );
+    level.reserve( nNodes );
+    left.reserve( nNodes );
+    right.reserve( nNodes );
+}
+
+// Add a node with the coordinate and the data to the tree
+template < typename T, typename U >
+void HXFlatAdtTree<T,U>::AddNode( U * coordinate, T data )
+{
+    int newNode = item.size();
+
+    coor.insert( coor.end(), coordinate, coordinate + dim );
+    item.push_back( data );
+    level.push_back( 0 );
+    left.push_back( -1 );
+    right.push_back( -1 );
+
+    if ( newNode == 0 ) return;
+
+    nwmin = pmin;
+    nwmax = pmax;
+
+    //walk down from the root, halving the window along the axis of each level
+    int iNode = 0;
+    while ( true )
+    {
+        int axis = level[ iNode ] % dim;
+        U mid = 0.5 * ( nwmin[ axis ] + nwmax[ axis ] );
+
+        if ( coordinate[ axis ] <= mid )
+        {
+            if ( left[ iNode ] < 0 )
+            {
+                left[ iNode ] = newNode;
+                break;
+            }
+            nwmax[ axis ] = mid;
+            iNode = left[ iNode ];
+        }
+        else
+        {
+            if ( right[ iNode ] < 0 )
+            {
+                right[ iNode ] = newNode;
+                break;
+            }
+            nwmin[ axis ] = mid;
+            iNode = right[ iNode ];
+        }
+    }
+
+    level[ newNode ] = level[ iNode ] + 1;
+}
+
+template < typename T, typename U >
+void HXFlatAdtTree<T,U>::AddNodes( U * coordinates, T * data, int nNodes )
+{
+    this->Reserve( this->nCount() + nNodes );
+    for ( int i = 0; i < nNodes; ++ i )
+    {
+        this->AddNode( coordinates + dim * i, data[ i ] );
+    }
+}
+
+// is the node inside region ( pmin, pmax )?
+template < typename T, typename U >
+bool HXFlatAdtTree<T,U>::IsInRegion( int iNode, U * pmin, U * pmax )
+{
+    U * point = & coor[ dim * iNode ];
+    for ( int i = 0; i < dim; ++ i )
+    {
+        if ( point[ i ] < pmin[ i ] || point[ i ] > pmax[ i ] )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template < typename T, typename U >
+void HXFlatAdtTree<T,U>::FindNodesInRegion( U * pmin, U * pmax, ItemList & items )
+{
+    items.resize( 0 );
+
+    if ( item.empty() ) return;
+
+    nwmin = this->pmin;
+    nwmax = this->pmax;
+
+    this->FindNodesInRegion( 0, pmin, pmax, items );
+}
+
+template < typename T, typename U >
+void HXFlatAdtTree<T,U>::FindNodesInRegion( int iNode, U * pmin, U * pmax, ItemList & items )
+{
+    if ( this->IsInRegion( iNode, pmin, pmax ) )
+    {
+        items.push_back( item[ iNode ] );
+    }
+
+    int axis = level[ iNode ] % dim;
+    U mid = 0.5 * ( nwmin[ axis ] + nwmax[ axis ] );
+    U temp;
+
+    if ( left[ iNode ] >= 0 )
+    {
+        if ( pmin[ axis ] <= mid && pmax[ axis ] >= nwmin[ axis ] )
+        {
+            temp          = nwmax[ axis ];
+            nwmax[ axis ] = mid;
+            this->FindNodesInRegion( left[ iNode ], pmin, pmax, items );
+            nwmax[ axis ] = temp;
+        }
+    }
+
+    if ( right[ iNode ] >= 0 )
+    {
+        if ( pmax[ axis ] >= mid && pmin[ axis ] <= nwmax[ axis ] )
+        {
+            temp          = nwmin[ axis ];
+            nwmin[ axis ] = mid;
+            this->FindNodesInRegion( right[ iNode ], pmin, pmax, items );
+            nwmin[ axis ] = temp;
+        }
+    }
+}
+
+EndNameSpace
@@ -22,11 +22,13 @@ License
 
 #pragma once
 #include "Marray.h"
+#include "MField.h"
 #include "Multiarray.h"
 
 BeginNameSpace( ONEFLOW )
 
 typedef Marray< Real > MRField;
+typedef MField< Real > MCField;
 
 typedef Multiarray< Real, 3 > Field3D;
 typedef Multiarray< int, 3 > Int3D;
@@ -0,0 +1,247 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXType.h"
+#include "Marray.h"
+#include <cstdint>
+#include <algorithm>
+
+BeginNameSpace( ONEFLOW )
+
+//SOA: equation-major, every equation row is padded to start aligned
+//AOS: cell-major, the nEqu values of one cell are contiguous
+enum FieldLayout
+{
+    FIELD_SOA = 0,
+    FIELD_AOS = 1
+};
+
+template < typename T >
+class MFieldRow
+{
+public:
+    MFieldRow( T * base, HXSize_t stride, HXSize_t n ) : base( base ), stride( stride ), n( n ) {}
+protected:
+    T * base;
+    HXSize_t stride;
+    HXSize_t n;
+public:
+    HXSize_t size() const { return n; }
+
+    T & operator[]( HXSize_t i )
+    {
+        return base[ i * stride ];
+    }
+
+    MFieldRow< T > & operator = ( const T & value )
+    {
+        for ( HXSize_t i = 0; i < n; ++ i )
+        {
+            base[ i * stride ] = value;
+        }
+        return * this;
+    }
+};
+
+//multi-equation field in a single aligned allocation, T must be a plain arithmetic type
+template < typename T >
+class MField
+{
+public:
+    MField()
+    {
+        this->Init();
+    }
+
+    MField( HXSize_t nEqu, int numberOfCells, int layout = FIELD_SOA, int align = 64 )
+    {
+        this->Init();
+        this->Alloc( nEqu, numberOfCells, layout, align );
+    }
+
+    ~MField()
+    {
+        delete [] raw;
+    }
+private:
+    MField( const MField< T > & rhs );
+    MField< T > & operator = ( const MField< T > & rhs );
+protected:
+    T * raw;
+    T * data;
+    HXSize_t nEqu, nCells;
+    HXSize_t nTotal;
+    HXSize_t eqStride, cellStride;
+    int layout, align;
+protected:
+    void Init()
+    {
+        raw = 0;
+        data = 0;
+        nEqu = 0;
+        nCells = 0;
+        nTotal = 0;
+        eqStride = 0;
+        cellStride = 0;
+        layout = FIELD_SOA;
+        align = 64;
+    }
+
+    //pad the leading dimension of the equation rows to whole alignment blocks
+    HXSize_t Pad( HXSize_t n )
+    {
+        HXSize_t width = align / sizeof( T );
+        if ( width <= 1 ) return n;
+        return ( ( n + width - 1 ) / width ) * width;
+    }
+
+    void SetStride()
+    {
+        if ( layout == FIELD_AOS )
+        {
+            eqStride = 1;
+            cellStride = nEqu;
+            nTotal = this->Pad( nEqu * nCells );
+        }
+        else
+        {
+            eqStride = this->Pad( nCells );
+            cellStride = 1;
+            nTotal = eqStride * nEqu;
+        }
+    }
+public:
+    void Alloc( HXSize_t nEqu, int numberOfCells, int layout = FIELD_SOA, int align = 64 )
+    {
+        delete [] raw;
+        this->nEqu = nEqu;
+        this->nCells = numberOfCells;
+        this->layout = layout;
+        this->align = align < static_cast< int >( sizeof( T ) ) ? sizeof( T ) : align;
+        this->SetStride();
+
+        HXSize_t nExtra = this->align / sizeof( T );
+        raw = new T[ nTotal + nExtra ]();
+        std::uintptr_t address = reinterpret_cast< std::uintptr_t >( raw );
+        HXSize_t offset = ( this->align - address % this->align ) % this->align;
+        data = raw + offset / sizeof( T );
+    }
+
+    //move the values into a new allocation with the other layout
+    void SetLayout( int newLayout )
+    {
+        if ( newLayout == layout ) return;
+
+        MField< T > tmp( nEqu, nCells, newLayout, align );
+        for ( HXSize_t iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            for ( HXSize_t iCell = 0; iCell < nCells; ++ iCell )
+            {
+                tmp( iEqu, iCell ) = ( * this )( iEqu, iCell );
+            }
+        }
+        this->Swap( tmp );
+    }
+
+    void Swap( MField< T > & rhs )
+    {
+        std::swap( raw, rhs.raw );
+        std::swap( data, rhs.data );
+        std::swap( nEqu, rhs.nEqu );
+        std::swap( nCells, rhs.nCells );
+        std::swap( nTotal, rhs.nTotal );
+        std::swap( eqStride, rhs.eqStride );
+        std::swap( cellStride, rhs.cellStride );
+        std::swap( layout, rhs.layout );
+        std::swap( align, rhs.align );
+    }
+public:
+    HXSize_t GetNEqu() { return nEqu; }
+    HXSize_t GetNCells() { return nCells; }
+    int GetLayout() { return layout; }
+    HXSize_t GetEquStride() { return eqStride; }
+    HXSize_t GetCellStride() { return cellStride; }
+    T * GetData() { return data; }
+
+    T & operator()( HXSize_t iEqu, HXSize_t iCell )
+    {
+        return data[ iEqu * eqStride + iCell * cellStride ];
+    }
+
+    MFieldRow< T > operator[]( HXSize_t iEqu )
+    {
+        return MFieldRow< T >( data + iEqu * eqStride, cellStride, nCells );
+    }
+
+    MFieldRow< T > AsOneD()
+    {
+        return ( * this )[ 0 ];
+    }
+
+    //contiguous equation row, only for FIELD_SOA
+    T * GetEqu( HXSize_t iEqu )
+    {
+        return data + iEqu * eqStride;
+    }
+
+    //contiguous cell block of nEqu values, only for FIELD_AOS
+    T * GetCell( HXSize_t iCell )
+    {
+        return data + iCell * cellStride;
+    }
+
+    MField< T > & operator = ( const T & value )
+    {
+        for ( HXSize_t i = 0; i < nTotal; ++ i )
+        {
+            data[ i ] = value;
+        }
+        return * this;
+    }
+public:
+    void CopyFrom( Marray< T > & field )
+    {
+        for ( HXSize_t iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            HXVector< T > & f = field[ iEqu ];
+            for ( HXSize_t iCell = 0; iCell < nCells; ++ iCell )
+            {
+                ( * this )( iEqu, iCell ) = f[ iCell ];
+            }
+        }
+    }
+
+    void CopyTo( Marray< T > & field )
+    {
+        for ( HXSize_t iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            HXVector< T > & f = field[ iEqu ];
+            for ( HXSize_t iCell = 0; iCell < nCells; ++ iCell )
+            {
+                f[ iCell ] = ( * this )( iEqu, iCell );
+            }
+        }
+    }
+};
+
+EndNameSpace
@@ -0,0 +1,136 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include <algorithm>
+
+BeginNameSpace( ONEFLOW )
+
+//one row of a CsrLink, it reads like the IntField of a LinkField row
+class CsrRow
+{
+public:
+    CsrRow( int * data, int nSize ) : data( data ), nSize( nSize ) {}
+public:
+    int * data;
+    int nSize;
+public:
+    int size() const { return nSize; }
+    bool empty() const { return nSize == 0; }
+    int & operator [] ( int i ) { return data[ i ]; }
+    const int & operator [] ( int i ) const { return data[ i ]; }
+    int * begin() { return data; }
+    int * end() { return data + nSize; }
+};
+
+//compressed row storage of a connectivity: row i is data[ start[ i ], start[ i + 1 ] )
+class CsrLink
+{
+public:
+    IntField start;
+    IntField data;
+public:
+    int size() const { return start.empty() ? 0 : static_cast< int >( start.size() ) - 1; }
+    int RowSize( int i ) const { return start[ i + 1 ] - start[ i ]; }
+    CsrRow operator [] ( int i ) { return CsrRow( data.data() + start[ i ], start[ i + 1 ] - start[ i ] ); }
+public:
+    void Clear()
+    {
+        start.resize( 0 );
+        data.resize( 0 );
+    }
+
+    //rowSize holds the length of every row, after the call start is ready and data is sized
+    void Alloc( IntField & rowSize )
+    {
+        int nRows = rowSize.size();
+        start.resize( nRows + 1 );
+        start[ 0 ] = 0;
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            start[ i + 1 ] = start[ i ] + rowSize[ i ];
+        }
+        data.resize( start[ nRows ] );
+    }
+
+    void Set( IntField & rowSize, IntField & flatData )
+    {
+        this->Alloc( rowSize );
+        data = flatData;
+    }
+
+    void Set( LinkField & link )
+    {
+        int nRows = link.size();
+        IntField rowSize( nRows );
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            rowSize[ i ] = link[ i ].size();
+        }
+        this->Alloc( rowSize );
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            std::copy( link[ i ].begin(), link[ i ].end(), data.begin() + start[ i ] );
+        }
+    }
+
+    //append one row, the grid builders grow the faces one at a time
+    void push_back( IntField & row )
+    {
+        if ( start.empty() ) start.push_back( 0 );
+        data.insert( data.end(), row.begin(), row.end() );
+        start.push_back( static_cast< int >( data.size() ) );
+    }
+
+    //row i of the result is the old row orderMap[ i ]
+    void ReOrder( IntField & orderMap )
+    {
+        int nRows = orderMap.size();
+        IntField rowSize( nRows );
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            rowSize[ i ] = this->RowSize( orderMap[ i ] );
+        }
+        CsrLink link;
+        link.Alloc( rowSize );
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            int j = orderMap[ i ];
+            std::copy( data.begin() + start[ j ], data.begin() + start[ j + 1 ], link.data.begin() + link.start[ i ] );
+        }
+        start.swap( link.start );
+        data.swap( link.data );
+    }
+
+    void ToLink( LinkField & link )
+    {
+        int nRows = this->size();
+        link.resize( nRows );
+        for ( int i = 0; i < nRows; ++ i )
+        {
+            link[ i ].assign( data.begin() + start[ i ], data.begin() + start[ i + 1 ] );
+        }
+    }
+};
+
+EndNameSpace
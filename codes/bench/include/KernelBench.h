@@ -0,0 +1,74 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include <string>
+#include <fstream>
+
+BeginNameSpace( ONEFLOW )
+
+//kernels run directly on every local zone, messages go through the task graph
+const int BENCH_MESSAGE  = 0;
+const int BENCH_GRAD     = 1;
+const int BENCH_LIMITER  = 2;
+const int BENCH_INV_FLUX = 3;
+const int BENCH_VIS_FLUX = 4;
+
+class BenchKernel
+{
+public:
+    BenchKernel();
+    BenchKernel( const std::string & name, int kind, int param, int streams );
+    ~BenchKernel();
+public:
+    std::string name;
+    int kind;
+    int param;
+    //cell arrays of nEqu values read or written per call, for the bandwidth estimate
+    int streams;
+};
+
+class KernelBench
+{
+public:
+    KernelBench();
+    ~KernelBench();
+public:
+    int nWarmup;
+    int nRepeat;
+    std::string fileName;
+    HXVector< BenchKernel > kernels;
+public:
+    void Init();
+    void Run();
+protected:
+    void AddKernels();
+    void RunKernel( BenchKernel & kernel );
+    void RunZoneKernel( BenchKernel & kernel );
+    int GetLocalCells();
+};
+
+//simutask = "Benchmark": load the case like a flow solve, then time the kernels instead of iterating
+void BenchSimu();
+
+EndNameSpace
@@ -0,0 +1,261 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "KernelBench.h"
+#include "FieldSimu.h"
+#include "MultiBlock.h"
+#include "SolverMap.h"
+#include "SolverState.h"
+#include "GridState.h"
+#include "ZoneState.h"
+#include "Zone.h"
+#include "Grid.h"
+#include "CmxTask.h"
+#include "DataBase.h"
+#include "Parallel.h"
+#include "Prj.h"
+#include "Profiler.h"
+#include "NsCom.h"
+#include "NsInvFlux.h"
+#include "UCom.h"
+#include "UNsCom.h"
+#include "UNsGrad.h"
+#include "UNsLimiter.h"
+#include "UNsInvFlux.h"
+#include "UNsVisFlux.h"
+#include "ULimiter.h"
+#include "AsyncFileWriter.h"
+#include "HXMath.h"
+#include <iostream>
+#include <iomanip>
+
+BeginNameSpace( ONEFLOW )
+
+BenchKernel::BenchKernel()
+{
+    kind = BENCH_MESSAGE;
+    param = 0;
+    streams = 0;
+}
+
+BenchKernel::BenchKernel( const std::string & name, int kind, int param, int streams )
+{
+    this->name = name;
+    this->kind = kind;
+    this->param = param;
+    this->streams = streams;
+}
+
+BenchKernel::~BenchKernel()
+{
+    ;
+}
+
+KernelBench::KernelBench()
+{
+    nWarmup = 1;
+    nRepeat = 10;
+}
+
+KernelBench::~KernelBench()
+{
+    ;
+}
+
+void KernelBench::Init()
+{
+    nWarmup = ONEFLOW::GetDataValueOrDefault< int >( "bench_warmup", 1 );
+    nRepeat = ONEFLOW::GetDataValueOrDefault< int >( "bench_repeat", 10 );
+    fileName = ONEFLOW::GetDataValueOrDefault< std::string >( "bench_file", "results/bench.csv" );
+    nRepeat = MAX( nRepeat, 1 );
+
+    this->AddKernels();
+}
+
+void KernelBench::AddKernels()
+{
+    kernels.push_back( BenchKernel( "GRAD_GG_CELL_WEIGHT", BENCH_GRAD, 0, 4 ) );
+    kernels.push_back( BenchKernel( "LIMITER_BARTH" , BENCH_LIMITER, ILMT_BARTH , 5 ) );
+    kernels.push_back( BenchKernel( "LIMITER_VENCAT", BENCH_LIMITER, ILMT_VENCAT, 5 ) );
+
+    kernels.push_back( BenchKernel( "INV_FLUX_ROE"           , BENCH_INV_FLUX, ISCHEME_ROE           , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_VANLEER"       , BENCH_INV_FLUX, ISCHEME_VANLEER       , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_STEGER"        , BENCH_INV_FLUX, ISCHEME_STEGER        , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_HLLE"          , BENCH_INV_FLUX, ISCHEME_HLLE          , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_LAX_FRIEDRICHS", BENCH_INV_FLUX, ISCHEME_LAX_FRIEDRICHS, 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_AUSMP"         , BENCH_INV_FLUX, ISCHEME_AUSMP         , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_AUSMPUP"       , BENCH_INV_FLUX, ISCHEME_AUSMPUP       , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_AUSMDV"        , BENCH_INV_FLUX, ISCHEME_AUSMDV        , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_AUSMW"         , BENCH_INV_FLUX, ISCHEME_AUSMW         , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_AUSMPW"        , BENCH_INV_FLUX, ISCHEME_AUSMPW        , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_HYBRIDROE"     , BENCH_INV_FLUX, ISCHEME_HYBRIDROE     , 7 ) );
+    kernels.push_back( BenchKernel( "INV_FLUX_SLAU2"         , BENCH_INV_FLUX, ISCHEME_SLAU2         , 7 ) );
+
+    kernels.push_back( BenchKernel( "VIS_FLUX", BENCH_VIS_FLUX, 0, 6 ) );
+
+    kernels.push_back( BenchKernel( "CALC_BOUNDARY"        , BENCH_MESSAGE, 0, 1 ) );
+    kernels.push_back( BenchKernel( "CALC_TIME_STEP"       , BENCH_MESSAGE, 0, 3 ) );
+    kernels.push_back( BenchKernel( "UPDATE_RESIDUALS"     , BENCH_MESSAGE, 0, 12 ) );
+    kernels.push_back( BenchKernel( "LUSGS_LOWER_SWEEP"    , BENCH_MESSAGE, 0, 3 ) );
+    kernels.push_back( BenchKernel( "LUSGS_UPPER_SWEEP"    , BENCH_MESSAGE, 0, 3 ) );
+    kernels.push_back( BenchKernel( "UPDATE_INTERFACE_DATA", BENCH_MESSAGE, 0, 1 ) );
+}
+
+int KernelBench::GetLocalCells()
+{
+    int nCells = 0;
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+        nCells += Zone::GetGrid( zId )->nCells;
+    }
+    return nCells;
+}
+
+void KernelBench::RunZoneKernel( BenchKernel & kernel )
+{
+    ug.Init();
+    unsf.Init();
+
+    if ( kernel.kind == BENCH_GRAD )
+    {
+        uns_grad.Init();
+        uns_grad.CalcGrad();
+    }
+    else if ( kernel.kind == BENCH_LIMITER )
+    {
+        NsLimiter * limiter = new NsLimiter();
+        limiter->limflag = kernel.param;
+        limiter->CalcLimiter();
+        delete limiter;
+    }
+    else if ( kernel.kind == BENCH_INV_FLUX )
+    {
+        int ischeme = nscom.ischeme;
+        nscom.ischeme = kernel.param;
+        UNsInvFlux * uNsInvFlux = new UNsInvFlux();
+        uNsInvFlux->CalcFlux();
+        delete uNsInvFlux;
+        nscom.ischeme = ischeme;
+    }
+    else if ( kernel.kind == BENCH_VIS_FLUX )
+    {
+        UNsVisFlux * uNsVisFlux = new UNsVisFlux();
+        uNsVisFlux->CalcFlux();
+        delete uNsVisFlux;
+    }
+}
+
+void KernelBench::RunKernel( BenchKernel & kernel )
+{
+    if ( kernel.kind == BENCH_MESSAGE )
+    {
+        ONEFLOW::MsMgTask( kernel.name );
+        return;
+    }
+
+    //the zone kernels belong to the flow solver on the finest grid
+    SolverState::SetTidById( 0 );
+    GridState::SetGridLevel( 0 );
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+        ZoneState::zid = zId;
+        this->RunZoneKernel( kernel );
+    }
+}
+
+void KernelBench::Run()
+{
+    int nLocalCells = this->GetLocalCells();
+    int nCells = nLocalCells;
+    ONEFLOW::HXReduceInt( & nLocalCells, & nCells, 1, PL_SUM );
+
+    Real bytesPerStream = static_cast< Real >( nCells ) * nscom.nTEqu * sizeof( Real );
+
+    std::fstream file;
+    bool server = Parallel::IsServer();
+    if ( server )
+    {
+        Prj::OpenPrjFile( file, fileName, std::ios_base::out );
+        file << "kernel,ranks,cells,repeat,seconds,cells_per_s,gb_per_s\n";
+        std::cout << std::setw( 26 ) << "kernel" << std::setw( 14 ) << "seconds";
+        std::cout << std::setw( 14 ) << "Mcells/s" << std::setw( 10 ) << "GB/s" << "\n";
+    }
+
+    for ( HXSize_t iKernel = 0; iKernel < kernels.size(); ++ iKernel )
+    {
+        BenchKernel & kernel = kernels[ iKernel ];
+
+        for ( int iter = 0; iter < nWarmup; ++ iter )
+        {
+            this->RunKernel( kernel );
+        }
+
+        HXBarrier();
+        Real t0 = Profiler::WallTime();
+        for ( int iter = 0; iter < nRepeat; ++ iter )
+        {
+            this->RunKernel( kernel );
+        }
+        Real localSpan = Profiler::WallTime() - t0;
+
+        //the slowest rank sets the time of a parallel kernel
+        Real span = localSpan;
+        ONEFLOW::HXReduceReal( & localSpan, & span, 1, PL_MAX );
+
+        if ( ! server ) continue;
+
+        Real perCall = span / nRepeat;
+        Real cellRate = perCall > 0.0 ? nCells / perCall : 0.0;
+        Real gbRate = perCall > 0.0 ? kernel.streams * bytesPerStream / perCall / 1.0e9 : 0.0;
+
+        file << kernel.name << "," << Parallel::GetNProc() << "," << nCells << "," << nRepeat << ",";
+        file << std::setprecision( 9 ) << span << "," << cellRate << "," << gbRate << "\n";
+
+        std::cout << std::setw( 26 ) << kernel.name << std::setw( 14 ) << std::setprecision( 6 ) << span;
+        std::cout << std::setw( 14 ) << cellRate / 1.0e6 << std::setw( 10 ) << gbRate << "\n";
+    }
+
+    if ( server )
+    {
+        Prj::CloseFile( file );
+    }
+}
+
+void BenchSimu()
+{
+    InitFlowSimuGlobal();
+    MultiBlock::LoadGridAndBuildLink();
+    MultiBlock::ProcessFlowWallDist();
+    SolverMap::CreateSolvers();
+    InitializeSolver();
+
+    KernelBench * kernelBench = new KernelBench();
+    kernelBench->Init();
+    kernelBench->Run();
+    delete kernelBench;
+
+    AsyncFileWriter::WaitAll();
+}
+
+EndNameSpace
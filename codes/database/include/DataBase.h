@@ -27,6 +27,7 @@ License
 #include "DataField.h"
 #include "DataObject.h"
 #include "DataPointer.h"
+#include "FieldHandle.h"
 #include "DataBaseType.h"
 #include <iostream>
 #include <fstream>
@@ -83,6 +84,17 @@ T GetDataValue( const std::string & varName, DataBase * database )
     }   
 }
 
+//Read the value of an optional variable, return defaultValue if it is not given in the scripts
+template < typename T >
+T GetDataValueOrDefault( const std::string & varName, const T & defaultValue, DataBase * database = ONEFLOW::GetGlobalDataBase() )
+{
+    DataV * datav = database->dataPara->GetDataPointer( varName );
+
+    if ( datav == NULL ) return defaultValue;
+
+    return GetDataValue< T >( datav->data );
+}
+
 template < typename T >
 void SetData( const std::string & name, T * value, int type, int size )
 {
@@ -115,6 +127,7 @@ class PointerWrap;
 PointerWrap * GetPointerWrap( DataField * dataField, const std::string & dataObjectName );
 
 void * GetFieldPointerVoid( DataBase * database, const std::string & dataObjectName );
+void * GetFieldPointerVoid( DataBase * database, int slot, const std::type_info & type );
 
 template < typename T >
 T * GetFieldPointer( DataBase * database, const std::string & dataObjectName );
@@ -161,6 +174,31 @@ T & GetFieldReference( TStorage * storage, const std::string & dataObjectName )
     return * ONEFLOW::GetFieldPointer< T, TStorage >( storage, dataObjectName );
 }
 
+//Handle lookups index the slot directly and check the type stored in this database
+template < typename T >
+T * GetFieldPointer( DataBase * database, const FieldHandle< T > & handle )
+{
+    return static_cast< T * >( GetFieldPointerVoid( database, handle.slot, typeid( T ) ) );
+}
+
+template < typename T, typename TStorage >
+T * GetFieldPointer( TStorage * storage, const FieldHandle< T > & handle )
+{
+    return ONEFLOW::GetFieldPointer< T >( storage->GetDataBase(), handle );
+}
+
+template < typename T >
+T & GetFieldReference( DataBase * database, const FieldHandle< T > & handle )
+{
+    return * ONEFLOW::GetFieldPointer< T >( database, handle );
+}
+
+template < typename T, typename TStorage >
+T & GetFieldReference( TStorage * storage, const FieldHandle< T > & handle )
+{
+    return * ONEFLOW::GetFieldPointer< T, TStorage >( storage, handle );
+}
+
 template < typename TStorage >
 void CreateFieldPointer( TStorage * storage, PointerWrap * pointerWrap, const std::string & dataObjectName )
 {
@@ -54,9 +54,12 @@ protected:
     void ResizeNPage( HXSize_t newNPage );
     HXLongLong_t  GetRemainingSizeOfCurrentPage();
     void MoveForwardPosition( HXLongLong_t dataSize );
+    void * MoveSpace( HXLongLong_t dataSize );
 public:
     void Read ( void * data, HXLongLong_t dataSize );
     void Write( void * data, HXLongLong_t dataSize );
+    void * ReadSpace ( HXLongLong_t dataSize );
+    void * WriteSpace( HXLongLong_t dataSize );
     void ReadFile ( std::fstream & file );
     void WriteFile( std::fstream & file );
 
@@ -24,6 +24,7 @@ License
 #include "Configure.h"
 #include <set>
 #include <string>
+#include <vector>
 
 BeginNameSpace( ONEFLOW )
 
@@ -61,10 +62,13 @@ public:
     ~DataField();
 protected:
     DataSET * dataSet;
+    //DataF of every field slot, see FieldHandle.h
+    std::vector< DataF * > slotData;
 public:
     void UpdateDataF( DataF * dataf );
     DataF * GetDataF( const std::string & name );
     void DeleteDataF( const std::string & name );
+    DataF * GetSlot( int slot );
 
     DataSET * GetDataSet() { return dataSet; }
 };
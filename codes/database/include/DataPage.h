@@ -47,6 +47,7 @@ public:
 
     char * GetBeginDataPointer();
     char * GetCurrentDataPointer();
+    char * MoveSpace( HXSize_t dataSize );
 
     void MoveToBegin() { MoveToPosition( 0 ); };
     void MoveToEnd  () { currPos = GetSize(); };
@@ -22,6 +22,7 @@ License
 
 #pragma once
 #include "Configure.h"
+#include <typeinfo>
 
 BeginNameSpace( ONEFLOW )
 
@@ -32,6 +33,7 @@ public:
     virtual ~PointerWrap() {};
 public:
     virtual void * GetPointer() { return 0; };
+    virtual const std::type_info & GetType() { return typeid( void ); };
 };
 
 template < typename T >
@@ -56,6 +58,7 @@ protected:
     T * data;
 public:
     void * GetPointer() override { return data; };
+    const std::type_info & GetType() override { return typeid( T ); };
 };
 
 
@@ -0,0 +1,59 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "Configure.h"
+#include <map>
+#include <string>
+
+BeginNameSpace( ONEFLOW )
+
+//every field name owns one integer slot, the same slot on every grid
+class FieldSlot
+{
+public:
+    FieldSlot();
+    ~FieldSlot();
+public:
+    static std::map< std::string, int > * nameMap;
+public:
+    static void Init();
+    static void Free();
+    static int FindSlot( const std::string & name );
+    static int Register( const std::string & name );
+};
+
+//typed field handle, the type is checked against the storage that is looked up
+template < typename T >
+class FieldHandle
+{
+public:
+    FieldHandle() : slot( - 1 ) {}
+    explicit FieldHandle( const std::string & name )
+    {
+        slot = FieldSlot::Register( name );
+    }
+public:
+    int slot;
+};
+
+EndNameSpace
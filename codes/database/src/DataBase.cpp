@@ -165,6 +165,7 @@ void SetDataString( const std::string & varName, Real & value )
 PointerWrap * GetPointerWrap( DataField * dataField, const std::string & dataObjectName )
 {
     DataF * dataf = dataField->GetDataF( dataObjectName );
+    if ( ! dataf ) return 0;
     return dataf->GetPointerWrap();
 }
 
@@ -185,6 +186,19 @@ void * GetFieldPointerVoid( DataBase * database, const std::string & dataObjectN
     return 0;
 }
 
+void * GetFieldPointerVoid( DataBase * database, int slot, const std::type_info & type )
+{
+    DataF * dataf = database->dataField->GetSlot( slot );
+    if ( ! dataf || ! dataf->data ) return 0;
+
+    const std::type_info & dataType = dataf->data->GetType();
+    if ( dataType != typeid( void ) && dataType != type )
+    {
+        Stop( "field " + dataf->name + " is used as " + type.name() + " but stored as " + dataType.name() + "\n" );
+    }
+    return dataf->data->GetPointer();
+}
+
 void DumpDataBase( std::fstream & file )
 {
     DataBase * dataBase = ONEFLOW::GetGlobalDataBase();
@@ -127,6 +127,37 @@ void DataBook::Write( void * data, HXLongLong_t dataSize )
     }
 }
 
+//Contiguous space of dataSize bytes at the current position, so that callers can
+//gather into or scatter from the book without a staging copy.
+//0 is returned when the space would cross a page, the caller then uses Read/Write.
+void * DataBook::ReadSpace( HXLongLong_t dataSize )
+{
+    if ( dataSize <= 0 ) return 0;
+
+    if ( this->currPos + dataSize > this->GetSize() ) return 0;
+
+    return this->MoveSpace( dataSize );
+}
+
+void * DataBook::WriteSpace( HXLongLong_t dataSize )
+{
+    if ( dataSize <= 0 ) return 0;
+
+    this->SecureRelativeSpace( dataSize );
+
+    return this->MoveSpace( dataSize );
+}
+
+void * DataBook::MoveSpace( HXLongLong_t dataSize )
+{
+    if ( this->GetRemainingSizeOfCurrentPage() < dataSize ) return 0;
+
+    void * data = this->GetCurrentPage()->MoveSpace( dataSize );
+    this->MoveForwardPosition( dataSize );
+
+    return data;
+}
+
 void DataBook::ReadString( std::string & cs )
 {
     HXSize_t nLength = 0;
@@ -24,6 +24,7 @@ License
 #include "DataField.h"
 #include "DataObject.h"
 #include "DataPointer.h"
+#include "FieldHandle.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -69,6 +70,13 @@ void DataField::UpdateDataF( DataF * dataf )
     if ( ! findData )
     {
         dataSet->insert( dataf );
+
+        int slot = FieldSlot::Register( dataf->name );
+        if ( slot >= static_cast< int >( slotData.size() ) )
+        {
+            slotData.resize( slot + 1, 0 );
+        }
+        slotData[ slot ] = dataf;
     }
     else
     {
@@ -81,29 +89,25 @@ void DataField::UpdateDataF( DataF * dataf )
 
 DataF * DataField::GetDataF( const std::string & name )
 {
-    DataF * data = new DataF( name, 0 );
-    DataSET::iterator iter = dataSet->find( data );
-    delete data;
-    if ( iter != dataSet->end() )
-    {
-        return ( * iter );
-    }
-    else
-    {
-        return 0;
-    }
+    return this->GetSlot( FieldSlot::FindSlot( name ) );
+}
+
+DataF * DataField::GetSlot( int slot )
+{
+    if ( slot < 0 || slot >= static_cast< int >( slotData.size() ) ) return 0;
+    return slotData[ slot ];
 }
 
 void DataField::DeleteDataF( const std::string & name )
 {
-    DataF * data = new DataF( name, 0 );
-    DataSET::iterator iter = dataSet->find( data );
-    if ( iter != dataSet->end() )
+    int slot = FieldSlot::FindSlot( name );
+    DataF * data = this->GetSlot( slot );
+    if ( data )
     {
-        delete ( * iter );
-        dataSet->erase( iter );
+        dataSet->erase( data );
+        slotData[ slot ] = 0;
+        delete data;
     }
-    delete data;
 }
 
 EndNameSpace
@@ -87,6 +87,14 @@ char * DataPage::GetCurrentDataPointer()
     return &( ( * dataMemory )[ currPos ] );
 }
 
+//Return the current position and move past dataSize bytes, the caller fills or reads them in place
+char * DataPage::MoveSpace( HXSize_t dataSize )
+{
+    char * data = this->GetCurrentDataPointer();
+    this->MoveForwardPosition( dataSize );
+    return data;
+}
+
 void DataPage::ToString( std::string & str )
 {
     if ( this->GetSize() )
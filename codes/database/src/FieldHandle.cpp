@@ -0,0 +1,76 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "FieldHandle.h"
+
+BeginNameSpace( ONEFLOW )
+
+std::map< std::string, int > * FieldSlot::nameMap = 0;
+
+FieldSlot::FieldSlot()
+{
+}
+
+FieldSlot::~FieldSlot()
+{
+}
+
+void FieldSlot::Init()
+{
+    if ( FieldSlot::nameMap ) return;
+    FieldSlot::nameMap = new std::map< std::string, int >();
+}
+
+void FieldSlot::Free()
+{
+    delete FieldSlot::nameMap;
+    FieldSlot::nameMap = 0;
+}
+
+int FieldSlot::FindSlot( const std::string & name )
+{
+    if ( ! FieldSlot::nameMap ) return - 1;
+
+    std::map< std::string, int >::iterator iter = FieldSlot::nameMap->find( name );
+    if ( iter == FieldSlot::nameMap->end() )
+    {
+        return - 1;
+    }
+    return iter->second;
+}
+
+//the slot only names the field, each storage keeps its own type for it
+int FieldSlot::Register( const std::string & name )
+{
+    FieldSlot::Init();
+
+    int slot = FieldSlot::FindSlot( name );
+    if ( slot < 0 )
+    {
+        slot = FieldSlot::nameMap->size();
+        ( * FieldSlot::nameMap )[ name ] = slot;
+    }
+
+    return slot;
+}
+
+EndNameSpace
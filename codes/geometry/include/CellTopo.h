@@ -23,6 +23,7 @@ License
 
 #pragma once
 #include "HXDefine.h"
+#include "CsrLink.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -38,7 +39,7 @@ public:
     IntField eTypes;
     IntField blank;
     LinkField elements;
-    LinkField c2f;
+    CsrLink c2f;
     LinkField c2c;
 public:
     void PushElement( int p1, int p2, int p3, int elementType );
@@ -25,6 +25,7 @@ License
 #include "HXDefine.h"
 #include "HXCgns.h"
 #include "HXMid.h"
+#include "CsrLink.h"
 #include <vector>
 #include <set>
 
@@ -48,7 +49,7 @@ public:
     FaceTopo * faceTopo;
 public:
     int FindFace( HXMid<int> & face );
-    bool CheckBcFace( IntSet & bcVertex, IntField & nodeId );
+    bool CheckBcFace( IntSet & bcVertex, CsrRow nodeId );
     void ScanElementFace( CgIntField & eNodeId, int eType, int eId );
     void ScanBcFace( IntSet & bcVertex, int bcType, int bcNameId );
     void ScanBcFaceDetail( IntSet & bcVertex, int bcType, int bcNameId );
@@ -24,6 +24,7 @@ License
 #pragma once
 #include "Constant.h"
 #include "HXDefine.h"
+#include "CsrLink.h"
 #include <vector>
 #include <string>
 #include <fstream>
@@ -45,8 +46,8 @@ public:
 public:
     int nCells;
     IntField fTypes;
-    LinkField faces;
-    LinkField c2f;
+    CsrLink faces;
+    CsrLink c2f;
 
     IntField lCells, rCells;
     IntField lPosition, rPosition;
@@ -57,6 +58,20 @@ public:
 public:
     LinkField facesNew;
     IntField lCellsNew, rCellsNew;
+public:
+    //conflict-free face groups: faces of one color never share a cell
+    IntField colorStart;
+    IntField colorFaces;
+public:
+    //LU-SGS wavefronts: cells of one level only depend on cells of earlier levels
+    IntField lowerLevelStart;
+    IntField lowerLevelCells;
+    IntField upperLevelStart;
+    IntField upperLevelCells;
+public:
+    //faces that never read the interface halo, and the interface faces that do
+    IntField innerFaces;
+    IntField haloFaces;
 public:
     HXSize_t GetNFaces() { return fTypes.size();  }
     HXSize_t CalcTotalFaceNodes();
@@ -75,6 +90,10 @@ public:
     bool GetSId( int iFace, int iPosition, int & sId );
     bool GetTId( int iFace, int iPosition, int & tId );
     void CalcC2C( LinkField & c2c );
+    void CalcFaceColor( CsrLink & c2f );
+    void CalcSweepLevel( CsrLink & c2f );
+    void CalcSweepLevel( CsrLink & c2f, int signOfSweep, IntField & levelStart, IntField & levelCells );
+    void CalcHaloFace();
 };
 
 EndNameSpace
@@ -24,6 +24,7 @@ License
 #include "HXDefine.h"
 #include "HXSort.h"
 #include "GridDef.h"
+#include "CsrLink.h"
 #include <set>
 
 BeginNameSpace( ONEFLOW )
@@ -73,7 +74,7 @@ public:
     void InitNewLgMapping();
 };
 
-void GetFaceCoorList( IntField & faceNode, RealField & xList, RealField & yList, RealField & zList, NodeMesh * nodeMesh );
+void GetFaceCoorList( CsrRow faceNode, RealField & xList, RealField & yList, RealField & zList, NodeMesh * nodeMesh );
 void GetCoorIdList( IFaceLink * iFaceLink, RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId );
 
 EndNameSpace
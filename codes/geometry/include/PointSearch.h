@@ -23,15 +23,14 @@ License
 
 #pragma once
 #include "HXDefine.h"
-#include "AdtTree.h"
+#include "FlatAdtTree.h"
 #include "GridDef.h"
 
 BeginNameSpace( ONEFLOW )
 
 class Grid;
 
-typedef HXAdtTree< int, Real > AdtTree;
-typedef HXAdtNode< int, Real > AdtNode;
+typedef HXFlatAdtTree< int, Real > AdtTree;
 
 class PointSearch
 {
@@ -43,6 +42,8 @@ protected:
     AdtTree * coorTree;
     Real tolerance;
     RealField xCoor, yCoor, zCoor;
+    //query buffer reused by every search
+    IntField nodeList;
 public:
     void Initialize( RealField & pmin, RealField & pmax, Real toleranceIn );
     void Initialize( Grid * grid );
@@ -54,9 +55,12 @@ public:
     int AddPoint( Real xm, Real ym, Real zm );
     void GetPoint( int id, Real & xm, Real & ym, Real & zm );
     Real GetTol() { return tolerance; }
+    void FindPoints( RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId );
+    void AddPoints( RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId );
 protected:
-    int AddPoint( RealField & coordinate );
-    int FindPoint( RealField & coordinate );
+    int AddPoint( Real * coordinate );
+    int FindPoint( Real * coordinate );
+    void FindNodesAround( Real * coordinate );
 public:
     void GetFaceCoorList( IntField & nodeId, RealField &xList, RealField &yList, RealField &zList );
 };
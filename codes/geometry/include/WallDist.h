@@ -53,6 +53,12 @@ public:
     PointLink  fv;
 };
 
+class WallTree;
+
+extern WallStructure * wallstruct;
+extern WallTree * walltree;
+extern LinkField wallFaceIds;
+
 void SetWallTask();
 void FreeWallStruct();
 Real CalcPoint2FaceDist( WallStructure::PointType node, WallStructure::PointField & fvList );
@@ -0,0 +1,56 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "WallDist.h"
+BeginNameSpace( ONEFLOW )
+
+//bounding volume hierarchy over the wall faces of a WallStructure
+class WallTree
+{
+public:
+    WallTree();
+    ~WallTree();
+public:
+    WallStructure * wall;
+    //node boxes, six values per node: xmin ymin zmin xmax ymax zmax
+    RealField box;
+    IntField  lChild;
+    IntField  rChild;
+    IntField  faceStart;
+    IntField  faceEnd;
+    //wall face ids in leaf order, a leaf owns faceId[ faceStart, faceEnd )
+    IntField  faceId;
+    RealField faceBox;
+public:
+    void Build( WallStructure * wall );
+    void Refit();
+    Real FindNearest( WallStructure::PointType & node, int & wallFaceId );
+    Real FindNearest( WallStructure::PointType & node, int & wallFaceId, Real bound );
+    Real CalcBoxDist( int iNode, WallStructure::PointType & node );
+protected:
+    void CalcFaceBox( int iWFace );
+    int  BuildNode( int start, int end, RealField & faceCenter );
+    void RefitNode( int iNode );
+};
+
+EndNameSpace
@@ -90,7 +90,7 @@ void CellMesh::CalcCellSpan( UnsGrid * grid )
     CalcC2f( grid );
 
     FaceTopo * faceTopo = grid->faceTopo;
-    LinkField & c2f = this->cellTopo->c2f;
+    CsrLink & c2f = this->cellTopo->c2f;
     IntField & lcf = faceTopo->lCells;
     IntField & rcf = faceTopo->rCells;
 
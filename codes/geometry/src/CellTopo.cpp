@@ -99,22 +99,38 @@ void CellTopo::CalcC2f( FaceTopo * faceTopo )
     int nCells = this->GetNumberOfCells();
     int nBFaces = faceTopo->GetNBFaces();
     int nFaces = faceTopo->GetNFaces();
-    int nTCell = nCells + nBFaces;
-    //c2f.resize( nCells );
-    c2f.resize( nTCell ); //add boundary cell for incompressible ns
+    int nTCell = nCells + nBFaces; //add boundary cell for incompressible ns
+
+    //count the faces of every cell, then fill the rows in ascending face order
+    IntField nCFaces( nTCell, 0 );
+
+    for ( int iFace = 0; iFace < nBFaces; ++ iFace )
+    {
+        ++ nCFaces[ faceTopo->lCells[ iFace ] ];
+    }
+
+    for ( int iFace = nBFaces; iFace < nFaces; ++ iFace )
+    {
+        ++ nCFaces[ faceTopo->lCells[ iFace ] ];
+        ++ nCFaces[ faceTopo->rCells[ iFace ] ];
+    }
+
+    c2f.Alloc( nCFaces );
+
+    IntField pos = c2f.start;
 
     for ( int iFace = 0; iFace < nBFaces; ++ iFace )
     {
         int lc  = faceTopo->lCells[ iFace ];
-        c2f[ lc  ].push_back( iFace );
+        c2f.data[ pos[ lc ] ++ ] = iFace;
     }
 
     for ( int iFace = nBFaces; iFace < nFaces; ++ iFace )
     {
         int lc  = faceTopo->lCells[ iFace ];
         int rc  = faceTopo->rCells[ iFace ];
-        c2f[ lc ].push_back( iFace );
-        c2f[ rc ].push_back( iFace );
+        c2f.data[ pos[ lc ] ++ ] = iFace;
+        c2f.data[ pos[ rc ] ++ ] = iFace;
     }
 }
 
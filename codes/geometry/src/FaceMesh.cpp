@@ -69,7 +69,7 @@ void FaceMesh::CalcFaceCenter1D( NodeMesh * nodeMesh )
 
     for ( HXSize_t iFace = 0; iFace < nFaces; ++ iFace )
     {
-        IntField & nodeIndex = faceTopo->faces[ iFace ];
+        CsrRow nodeIndex = faceTopo->faces[ iFace ];
         int p1 = nodeIndex[ 0 ];
         int p2 = nodeIndex[ 0 ];
         xfc[ iFace ] = half * ( xN[ p1 ] + xN[ p2 ] );
@@ -119,7 +119,7 @@ void FaceMesh::CalcFaceNormal2D( NodeMesh * nodeMesh )
 
     for ( HXSize_t iFace = 0; iFace < nFaces; ++ iFace )
     {
-        IntField & faceIndex = faceTopo->faces[ iFace ];
+        CsrRow faceIndex = faceTopo->faces[ iFace ];
         int p1 = faceIndex[ 0 ];
         int p2 = faceIndex[ 1 ];
 
@@ -148,7 +148,7 @@ void FaceMesh::CalcFaceCenter2D( NodeMesh * nodeMesh )
 
     for ( HXSize_t iFace = 0; iFace < nFaces; ++ iFace )
     {
-        IntField & nodeIndex = faceTopo->faces[ iFace ];
+        CsrRow nodeIndex = faceTopo->faces[ iFace ];
         int p1 = nodeIndex[ 0 ];
         int p2 = nodeIndex[ 1 ];
         xfc[ iFace ] = half * ( xN[ p1 ] + xN[ p2 ] );
@@ -173,7 +173,7 @@ void FaceMesh::CalcFaceNormal3D( NodeMesh * nodeMesh )
 
     for ( HXSize_t iFace = 0; iFace < nFaces; ++ iFace )
     {
-        IntField & faceIndex = faceTopo->faces[ iFace ];
+        CsrRow faceIndex = faceTopo->faces[ iFace ];
 
         HXSize_t faceNodeNumber = faceIndex.size();
         for ( HXSize_t iNodeInFace = 0; iNodeInFace < faceNodeNumber; ++ iNodeInFace )
@@ -221,7 +221,7 @@ void FaceMesh::CalcFaceCenter3D( NodeMesh * nodeMesh )
         Real y0 = 0.0;
         Real z0 = 0.0;
 
-        IntField & faceIndex = faceTopo->faces[ iFace ];
+        CsrRow faceIndex = faceTopo->faces[ iFace ];
 
         HXSize_t faceNodeNumber = faceIndex.size();
         for ( HXSize_t iNodeInFace = 0; iNodeInFace < faceNodeNumber; ++ iNodeInFace )
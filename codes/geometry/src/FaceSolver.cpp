@@ -60,7 +60,7 @@ int FaceSolver::FindFace( HXMid<int> & face )
     return iter->id;
 }
 
-bool FaceSolver::CheckBcFace( IntSet & bcVertex, IntField & nodeId )
+bool FaceSolver::CheckBcFace( IntSet & bcVertex, CsrRow nodeId )
 {
     int size = nodeId.size();
     for ( int iNode = 0; iNode < size; ++ iNode )
@@ -48,13 +48,7 @@ FaceTopo::~FaceTopo()
 
 HXSize_t FaceTopo::CalcTotalFaceNodes()
 {
-    HXSize_t totalNumFaceNodes = 0;
-    HXSize_t nFaces = this->GetNFaces();
-    for ( HXSize_t iFace = 0; iFace < nFaces; ++ iFace )
-    {
-        totalNumFaceNodes += faces[ iFace ].size();
-    }
-    return totalNumFaceNodes;
+    return faces.data.size();
 }
 
 HXSize_t FaceTopo::GetNBFaces()
@@ -340,7 +334,7 @@ void FaceTopo::UpdateOtherTopologyTerm()
     this->bcManager->Update();
     this->lCells = this->lCellsNew;
     this->rCells = this->rCellsNew;
-    this->faces = this->facesNew;
+    this->faces.Set( this->facesNew );
 }
 
 void FaceTopo::GenerateI2B( InterFace * interFace )
@@ -364,6 +358,132 @@ bool FaceTopo::GetTId( int iFace, int iPosition, int & tId )
     return true;
 }
 
+void FaceTopo::CalcFaceColor( CsrLink & c2f )
+{
+    if ( colorStart.size() != 0 ) return;
+
+    int nBFaces = this->GetNBFaces();
+    int nFaces = this->GetNFaces();
+
+    IntField faceColor( nFaces, -1 );
+    IntField colorMark;
+    IntField colorCount;
+
+    //greedy coloring: take the smallest color not used by the faces of lc and rc
+    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    {
+        int lc = this->lCells[ iFace ];
+        int rc = this->rCells[ iFace ];
+        int nSide = ( iFace < nBFaces ) ? 1 : 2;
+
+        for ( int iSide = 0; iSide < nSide; ++ iSide )
+        {
+            int cId = ( iSide == 0 ) ? lc : rc;
+            int nCFaces = c2f[ cId ].size();
+            for ( int i = 0; i < nCFaces; ++ i )
+            {
+                int color = faceColor[ c2f[ cId ][ i ] ];
+                if ( color >= 0 ) colorMark[ color ] = iFace;
+            }
+        }
+
+        int nColors = colorMark.size();
+        int iColor = 0;
+        while ( iColor < nColors && colorMark[ iColor ] == iFace )
+        {
+            ++ iColor;
+        }
+
+        if ( iColor == nColors )
+        {
+            colorMark.push_back( -1 );
+            colorCount.push_back( 0 );
+        }
+
+        faceColor[ iFace ] = iColor;
+        colorCount[ iColor ] += 1;
+    }
+
+    int nColors = colorCount.size();
+    colorStart.resize( nColors + 1 );
+    colorStart[ 0 ] = 0;
+    for ( int iColor = 0; iColor < nColors; ++ iColor )
+    {
+        colorStart[ iColor + 1 ] = colorStart[ iColor ] + colorCount[ iColor ];
+    }
+
+    colorFaces.resize( nFaces );
+    colorCount = 0;
+    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    {
+        int iColor = faceColor[ iFace ];
+        colorFaces[ colorStart[ iColor ] + colorCount[ iColor ] ] = iFace;
+        colorCount[ iColor ] += 1;
+    }
+}
+
+void FaceTopo::CalcSweepLevel( CsrLink & c2f )
+{
+    if ( lowerLevelStart.size() != 0 ) return;
+
+    this->CalcSweepLevel( c2f,   1, lowerLevelStart, lowerLevelCells );
+    this->CalcSweepLevel( c2f, - 1, upperLevelStart, upperLevelCells );
+}
+
+void FaceTopo::CalcSweepLevel( CsrLink & c2f, int signOfSweep, IntField & levelStart, IntField & levelCells )
+{
+    int nCells = this->grid->nCells;
+
+    IntField cellLevel( nCells, 0 );
+    IntField levelCount;
+
+    //a cell is one level above the deepest neighbor already swept before it
+    for ( int i = 0; i < nCells; ++ i )
+    {
+        int cId = ( signOfSweep > 0 ) ? i : nCells - 1 - i;
+        int level = 0;
+        int nCFaces = c2f[ cId ].size();
+        for ( int iFace = 0; iFace < nCFaces; ++ iFace )
+        {
+            int fId = c2f[ cId ][ iFace ];
+            int nId = ( this->lCells[ fId ] == cId ) ? this->rCells[ fId ] : this->lCells[ fId ];
+            if ( nId >= nCells ) continue;
+
+            bool sweptBefore = ( signOfSweep > 0 ) ? ( nId < cId ) : ( nId > cId );
+            if ( sweptBefore )
+            {
+                level = MAX( level, cellLevel[ nId ] + 1 );
+            }
+        }
+
+        cellLevel[ cId ] = level;
+        int nLevels = levelCount.size();
+        if ( level == nLevels )
+        {
+            levelCount.push_back( 0 );
+        }
+        levelCount[ level ] += 1;
+    }
+
+    int nLevels = levelCount.size();
+    levelStart.resize( nLevels + 1 );
+    levelStart[ 0 ] = 0;
+    for ( int iLevel = 0; iLevel < nLevels; ++ iLevel )
+    {
+        levelStart[ iLevel + 1 ] = levelStart[ iLevel ] + levelCount[ iLevel ];
+    }
+
+    levelCells.resize( nCells );
+    levelCount = 0;
+    for ( int i = 0; i < nCells; ++ i )
+    {
+        int cId = ( signOfSweep > 0 ) ? i : nCells - 1 - i;
+        int level = cellLevel[ cId ];
+        levelCells[ levelStart[ level ] + levelCount[ level ] ] = cId;
+        levelCount[ level ] += 1;
+    }
+}
+
 void FaceTopo::CalcC2C( LinkField & c2c )
 {
     if ( c2c.size() != 0 ) return;
@@ -395,4 +515,32 @@ void FaceTopo::CalcC2C( LinkField & c2c )
     }
 }
 
+void FaceTopo::CalcHaloFace()
+{
+    if ( innerFaces.size() != 0 || haloFaces.size() != 0 ) return;
+
+    int nBFaces = this->GetNBFaces();
+    int nFaces = this->GetNFaces();
+
+    //only the interface faces see the ghost cells filled by the halo exchange
+    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    {
+        bool haloFace = false;
+        if ( iFace < nBFaces )
+        {
+            int bcType = this->bcManager->bcRecord->bcType[ iFace ];
+            haloFace = BC::IsInterfaceBc( bcType );
+        }
+
+        if ( haloFace )
+        {
+            this->haloFaces.push_back( iFace );
+        }
+        else
+        {
+            this->innerFaces.push_back( iFace );
+        }
+    }
+}
+
 EndNameSpace
@@ -324,17 +324,15 @@ void GridElem::ReorderLink( UnsGrid * grid )
             ++ iCount;
         }
     }
-    faceTopo->facesNew.resize( nFaces );
     faceTopo->lCellsNew.resize( nFaces );
     faceTopo->rCellsNew.resize( nFaces );
     for ( int iFace = 0; iFace < nFaces; ++ iFace )
     {
         int jFace = f2map[ iFace ];
-        faceTopo->facesNew[ iFace ] = faceTopo->faces[ jFace ];
         faceTopo->lCellsNew[ iFace ] = faceTopo->lCells[ jFace ];
         faceTopo->rCellsNew[ iFace ] = faceTopo->rCells[ jFace ];
     }
-    faceTopo->faces = faceTopo->facesNew;
+    faceTopo->faces.ReOrder( f2map );
     faceTopo->lCells = faceTopo->lCellsNew;
     faceTopo->rCells = faceTopo->rCellsNew;
 }
@@ -203,14 +203,7 @@ void IFaceLink::MatchPeoridicInterface( Grid * grid )
         int nNodes = xxList.size( );
         IntField faceNode_period;
 
-        for ( int i = 0; i < nNodes; ++ i )
-        {
-            Real xm = xxList[ i ];
-            Real ym = yyList[ i ];
-            Real zm = zzList[ i ];
-            int id = this->point_search->FindPoint( xm, ym, zm );
-            faceNode_period.push_back( id );
-        }
+        this->point_search->FindPoints( xxList, yyList, zzList, nNodes, faceNode_period );
 
         int faceId_period = this->face_search->FindFace( faceNode_period );
 
@@ -224,7 +217,7 @@ void IFaceLink::MatchPeoridicInterface( Grid * grid )
     int kkk = 1;
 }
 
-void GetFaceCoorList( IntField & faceNode, RealField & xList, RealField & yList, RealField & zList, NodeMesh * nodeMesh )
+void GetFaceCoorList( CsrRow faceNode, RealField & xList, RealField & yList, RealField & zList, NodeMesh * nodeMesh )
 {
     int nPoint = faceNode.size();
     for ( int iNode = 0; iNode < nPoint; ++ iNode )
@@ -238,14 +231,7 @@ void GetFaceCoorList( IntField & faceNode, RealField & xList, RealField & yList,
 
 void GetCoorIdList( IFaceLink * iFaceLink, RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId )
 {
-    for ( int iNode = 0; iNode < nPoint; ++ iNode )
-    {
-        Real xm = xList[ iNode ];
-        Real ym = yList[ iNode ];
-        Real zm = zList[ iNode ];
-
-        pointId[ iNode ] = iFaceLink->point_search->AddPoint( xm, ym, zm );
-    }
+    iFaceLink->point_search->AddPoints( xList, yList, zList, nPoint, pointId );
 }
 
 EndNameSpace
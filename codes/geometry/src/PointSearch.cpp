@@ -62,27 +62,30 @@ void PointSearch::Initialize( Grids & grids )
     ONEFLOW::CreateStandardADT( grids, this->coorTree, tolerance );
 }
 
-int PointSearch::AddPoint( RealField & coor )
+void PointSearch::FindNodesAround( Real * coor )
 {
     Real minWindow[ 3 ];
     Real maxWindow[ 3 ];
 
-    minWindow[ 0 ] = coor[ 0 ] - tolerance;
-    minWindow[ 1 ] = coor[ 1 ] - tolerance;
-    minWindow[ 2 ] = coor[ 2 ] - tolerance;
+    minWindow[ 0 ] = coor[ 0 ] - this->tolerance;
+    minWindow[ 1 ] = coor[ 1 ] - this->tolerance;
+    minWindow[ 2 ] = coor[ 2 ] - this->tolerance;
 
-    maxWindow[ 0 ] = coor[ 0 ] + tolerance;
-    maxWindow[ 1 ] = coor[ 1 ] + tolerance;
-    maxWindow[ 2 ] = coor[ 2 ] + tolerance;
+    maxWindow[ 0 ] = coor[ 0 ] + this->tolerance;
+    maxWindow[ 1 ] = coor[ 1 ] + this->tolerance;
+    maxWindow[ 2 ] = coor[ 2 ] + this->tolerance;
 
-    AdtTree::AdtNodeList nodeList;
-    this->coorTree->FindNodesInRegion( minWindow, maxWindow, nodeList );
+    this->coorTree->FindNodesInRegion( minWindow, maxWindow, this->nodeList );
+}
+
+int PointSearch::AddPoint( Real * coor )
+{
+    this->FindNodesAround( coor );
 
     if ( nodeList.size() == 0 )
     {
         int count = this->xCoor.size();
-        AdtNode * node = new AdtNode( 3, & coor[ 0 ], count );
-        this->coorTree->AddNode( node );
+        this->coorTree->AddNode( coor, count );
         this->id = this->xCoor.size();
 
         xCoor.push_back( coor[ 0 ] );
@@ -98,9 +101,8 @@ int PointSearch::AddPoint( RealField & coor )
             std::cout << "FATAL ERROR : nodeList.size() = " << nodeList.size() << std::endl;
             Stop("");
         }
-        AdtNode * node =  nodeList[ 0 ];
 
-        this->id = node->GetData();
+        this->id = nodeList[ 0 ];
 
         return this->id;
     }
@@ -115,39 +117,19 @@ void PointSearch::GetPoint( int id, Real & xm, Real & ym, Real & zm )
 
 int PointSearch::AddPoint( Real xm, Real ym, Real zm )
 {
-    RealField coor( 3 );
-    coor[ 0 ] = xm;
-    coor[ 1 ] = ym;
-    coor[ 2 ] = zm;
+    Real coor[ 3 ] = { xm, ym, zm };
     return this->AddPoint( coor );
 }
 
 int PointSearch::FindPoint( Real xm, Real ym, Real zm )
 {
-    RealField coor( 3 );
-    coor[ 0 ] = xm;
-    coor[ 1 ] = ym;
-    coor[ 2 ] = zm;
+    Real coor[ 3 ] = { xm, ym, zm };
     return this->FindPoint( coor );
 }
 
-int PointSearch::FindPoint( RealField & coordinate )
+int PointSearch::FindPoint( Real * coordinate )
 {
-    AdtTree::AdtNodeList nodeList;
-
-    Real minWindow[ 3 ];
-    Real maxWindow[ 3 ];
-
-    minWindow[ 0 ] = coordinate[ 0 ] - this->tolerance;
-    minWindow[ 1 ] = coordinate[ 1 ] - this->tolerance;
-    minWindow[ 2 ] = coordinate[ 2 ] - this->tolerance;
-
-    maxWindow[ 0 ] = coordinate[ 0 ] + this->tolerance;
-    maxWindow[ 1 ] = coordinate[ 1 ] + this->tolerance;
-    maxWindow[ 2 ] = coordinate[ 2 ] + this->tolerance;
-
-    nodeList.resize( 0 );
-    this->coorTree->FindNodesInRegion( minWindow, maxWindow, nodeList );
+    this->FindNodesAround( coordinate );
 
     if ( nodeList.size() == 0 )
     {
@@ -157,18 +139,34 @@ int PointSearch::FindPoint( RealField & coordinate )
     {
         if ( nodeList.size() > 1 )
         {
-            int numberOfSize = nodeList.size();
             std::cout << " impossible nodeList.size() = " << nodeList.size() << std::endl;
-            
-            int kkk = 1;
             Stop( "" );
         }
-        AdtNode * node = nodeList[ 0 ];
-        this->id = node->GetData();
+        this->id = nodeList[ 0 ];
         return this->id;
     }
 }
 
+void PointSearch::FindPoints( RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId )
+{
+    pointId.resize( nPoint );
+    for ( int iPoint = 0; iPoint < nPoint; ++ iPoint )
+    {
+        Real coor[ 3 ] = { xList[ iPoint ], yList[ iPoint ], zList[ iPoint ] };
+        pointId[ iPoint ] = this->FindPoint( coor );
+    }
+}
+
+void PointSearch::AddPoints( RealField & xList, RealField & yList, RealField & zList, int nPoint, IntField & pointId )
+{
+    pointId.resize( nPoint );
+    for ( int iPoint = 0; iPoint < nPoint; ++ iPoint )
+    {
+        Real coor[ 3 ] = { xList[ iPoint ], yList[ iPoint ], zList[ iPoint ] };
+        pointId[ iPoint ] = this->AddPoint( coor );
+    }
+}
+
 void PointSearch::GetFaceCoorList( IntField & nodeId, RealField &xList, RealField &yList, RealField &zList )
 {
     for ( int i = 0; i < nodeId.size(); ++ i )
@@ -130,7 +130,6 @@ void UnsGrid::NormalizeBc()
 
 void UnsGrid::ReadGridFaceTopology( DataBook * databook )
 {
-    this->faceTopo->faces.resize( this->nFaces );
     this->faceTopo->lCells.resize( this->nFaces );
     this->faceTopo->rCells.resize( this->nFaces );
     this->faceTopo->fTypes.resize( this->nFaces );
@@ -139,23 +138,12 @@ void UnsGrid::ReadGridFaceTopology( DataBook * databook )
 
     ONEFLOW::HXRead( databook, numFaceNode );
 
-    int nsum = ONEFLOW::SUM( numFaceNode );
-
     std::cout << "Setting the connection mode of face to point......\n";
-    IntField faceNodeMem( nsum );
 
-    ONEFLOW::HXRead( databook, faceNodeMem );
+    //the file already stores the faces as row lengths plus one flat node list, which is read in place
+    this->faceTopo->faces.Alloc( numFaceNode );
 
-    int ipos = 0;
-    for ( int iFace = 0; iFace < this->nFaces; ++ iFace )
-    {
-        int nNodes = numFaceNode[ iFace ];
-        for ( int iNode = 0; iNode < nNodes; ++ iNode )
-        {
-            int pid = faceNodeMem[ ipos ++ ];
-            this->faceTopo->faces[ iFace ].push_back( pid );
-        }
-    }
+    ONEFLOW::HXRead( databook, this->faceTopo->faces.data );
 
     std::cout << "Setting the connection mode of face to cell......\n";
 
@@ -167,7 +155,7 @@ void UnsGrid::ReadGridFaceTopology( DataBook * databook )
         if ( this->faceTopo->lCells[ iFace ] < 0 )
         {
             //need to reverse the node ordering
-            IntField & f2n = this->faceTopo->faces[ iFace ];
+            CsrRow f2n = this->faceTopo->faces[ iFace ];
             std::reverse( f2n.begin(), f2n.end() );
             // now reverse leftCellIndex  and rightCellIndex
             ONEFLOW::SWAP( this->faceTopo->lCells[ iFace ], this->faceTopo->rCells[ iFace ] );
@@ -246,22 +234,13 @@ void UnsGrid::WriteGridFaceTopology1D( DataBook * databook )
 
     for ( int iFace = 0; iFace < this->nFaces; ++ iFace )
     {
-        numFaceNode[ iFace ] = this->faceTopo->faces[ iFace ].size();
+        numFaceNode[ iFace ] = this->faceTopo->faces.RowSize( iFace );
     }
 
     ONEFLOW::HXWrite( databook, numFaceNode );
 
-    IntField faceNodeMem;
-
-    for ( int iFace = 0; iFace < this->nFaces; ++ iFace )
-    {
-        int nNodes = numFaceNode[ iFace ];
-        for ( int iNode = 0; iNode < nNodes; ++ iNode )
-        {
-            faceNodeMem.push_back( this->faceTopo->faces[ iFace ][ iNode ] );
-        }
-    }
-    ONEFLOW::HXWrite( databook, faceNodeMem );
+    //the flat node list of the faces is written as it is stored
+    ONEFLOW::HXWrite( databook, this->faceTopo->faces.data );
 
     ONEFLOW::HXWrite( databook, this->faceTopo->lCells );
     ONEFLOW::HXWrite( databook, this->faceTopo->rCells );
@@ -273,22 +252,13 @@ void UnsGrid::WriteGridFaceTopology( DataBook * databook )
 
     for ( int iFace = 0; iFace < this->nFaces; ++ iFace )
     {
-        numFaceNode[ iFace ] = this->faceTopo->faces[ iFace ].size();
+        numFaceNode[ iFace ] = this->faceTopo->faces.RowSize( iFace );
     }
 
     ONEFLOW::HXWrite( databook, numFaceNode );
 
-    IntField faceNodeMem;
-
-    for ( int iFace = 0; iFace < this->nFaces; ++ iFace )
-    {
-        int nNodes = numFaceNode[ iFace ];
-        for ( int iNode = 0; iNode < nNodes; ++ iNode )
-        {
-            faceNodeMem.push_back( this->faceTopo->faces[ iFace ][ iNode ] );
-        }
-    }
-    ONEFLOW::HXWrite( databook, faceNodeMem );
+    //the flat node list of the faces is written as it is stored
+    ONEFLOW::HXWrite( databook, this->faceTopo->faces.data );
 
     ONEFLOW::HXWrite( databook, this->faceTopo->lCells );
     ONEFLOW::HXWrite( databook, this->faceTopo->rCells );
@@ -375,7 +345,7 @@ void UnsGrid::GenerateLgMapping( IFaceLink * iFaceLink )
         {
             continue;
         }
-        IntField & faceNode = this->faceTopo->faces[ iBFace ];
+        CsrRow faceNode = this->faceTopo->faces[ iBFace ];
         int nNodes = faceNode.size();
 
         gINode.resize( nNodes );
@@ -438,7 +408,7 @@ void UnsGrid::GetMinMaxDistance( Real & dismin, Real & dismax )
 
     for ( int iFace = 0; iFace < nFaces; ++ iFace )
     {
-        IntField & faceNode = this->faceTopo->faces[ iFace ];
+        CsrRow faceNode = this->faceTopo->faces[ iFace ];
         int nNodes = faceNode.size();
         for ( int iNode = 0; iNode < nNodes; ++ iNode )
         {
@@ -778,7 +748,7 @@ void UnsGrid::CalcCellCenterVol3D()
         int lc = faceTopo->lCells[ iFace ];
         int rc = faceTopo->rCells[ iFace ];
 
-        IntField & faceIndex = faceTopo->faces[ iFace ];
+        CsrRow faceIndex = faceTopo->faces[ iFace ];
 
         HXSize_t faceNodeNumber = faceIndex.size();
         for ( HXSize_t iNode = 0; iNode < faceNodeNumber; ++ iNode )
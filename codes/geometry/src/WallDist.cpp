@@ -21,6 +21,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "WallDist.h"
+#include "WallTree.h"
 #include "CmxTask.h"
 #include "TaskState.h"
 #include "NsCtrl.h"
@@ -49,14 +50,42 @@ License
 #include "GteDistPointTriangleExact.h"
 #include "HXMath.h"
 #include "LogFile.h"
+#include "DataBase.h"
 
 BeginNameSpace( ONEFLOW )
 
 WallStructure * wallstruct = 0;
+WallTree * walltree = 0;
+//true after FILL_WALL_STRUCT gathered new wall coordinates that the tree does not know yet
+bool wallfilled = false;
+//nearest wall face of every cell, one list per zone, the starting candidate of the next update
+LinkField wallFaceIds;
 
 void FreeWallStruct()
 {
+    delete walltree;
     delete wallstruct;
+    walltree = 0;
+    wallstruct = 0;
+    wallFaceIds.resize( 0 );
+}
+
+void UpdateWallTree()
+{
+    if ( ! wallfilled ) return;
+    wallfilled = false;
+
+    //a wall that only moved keeps its faces in the same order, so the tree is refitted in place
+    if ( walltree && walltree->faceId.size() == wallstruct->fv.size() )
+    {
+        walltree->Refit();
+        return;
+    }
+
+    delete walltree;
+    walltree = new WallTree();
+    walltree->Build( wallstruct );
+    wallFaceIds.resize( 0 );
 }
 
 void SetWallTask()
@@ -153,44 +182,59 @@ void CalcWallDist( StringField & data )
 
     std::cout << "zone " << grid->id << std::endl;
 
-    WallStructure::PointField & fc = wallstruct->fc;
-    WallStructure::PointLink  & fv = wallstruct->fv;
+    UpdateWallTree();
 
     int nWFace = wallstruct->fc.size();
 
-    for ( int cId = 0; cId < nCells; ++ cId )
+    std::cout << " pid = " << Parallel::pid << " Zone = " << grid->id;
+    std::cout << " nCells = " << nCells;
+    std::cout << " nWFace = " << nWFace << std::endl;
+
+    if ( static_cast<int>( wallFaceIds.size() ) < ZoneState::nZones )
     {
-        if ( cId % 10000 == 0 )
-        {
-            std::cout << " pid = " << Parallel::pid << " Zone = " << grid->id;
-            std::cout << " cid = " << cId << " " << "nCells = " << nCells;
-            std::cout << " nWFace = " << nWFace << std::endl;
-        }
+        wallFaceIds.resize( ZoneState::nZones );
+    }
+
+    IntField & nearFace = wallFaceIds[ ZoneState::zid ];
+    if ( static_cast<int>( nearFace.size() ) != nCells )
+    {
+        nearFace.resize( 0 );
+        nearFace.resize( nCells, -1 );
+    }
+
+    //the grid tasks do not run Ctrl::Init, so the thread count is read here
+    int nthreads = MAX( GetDataValueOrDefault< int >( "nthreads", 1 ), 1 );
 
+    //the tree only prunes faces that cannot be nearer, so the distance equals the exhaustive search
+#pragma omp parallel for schedule( dynamic, 1024 ) num_threads( nthreads )
+    for ( int cId = 0; cId < nCells; ++ cId )
+    {
         Real xc = xcc[ cId ];
         Real yc = ycc[ cId ];
         Real zc = zcc[ cId ];
 
         WallStructure::PointType ccp( xc, yc, zc );
 
-        for ( int iWFace = 0; iWFace < nWFace; ++ iWFace )
+        int candidate = nearFace[ cId ];
+
+        if ( candidate < 0 || candidate >= nWFace )
         {
-            WallStructure::PointField  & fvList = fv[ iWFace ];
+            dist[ cId ] = walltree->FindNearest( ccp, nearFace[ cId ] );
+            continue;
+        }
 
-            Real wdst = CalcPoint2FaceDist( ccp, fvList );
+        //the previous nearest face bounds the search, only faces that came closer are visited
+        Real bound = CalcPoint2FaceDist( ccp, wallstruct->fv[ candidate ] );
 
-            if ( wdst < 1.0e-30 )
-            {
-            }
+        int wallFaceId = -1;
+        dist[ cId ] = walltree->FindNearest( ccp, wallFaceId, bound );
 
-            if ( dist[ cId ] > wdst )
-            {
-                dist[ cId ] = wdst;
-            }
-        }        
+        if ( wallFaceId >= 0 )
+        {
+            nearFace[ cId ] = wallFaceId;
+        }
     }
 
-
     for ( int cId = 0; cId < nCells; ++ cId )
     {
         dist[ cId ] = sqrt( dist[ cId ] );
@@ -231,7 +275,14 @@ void CFillWallStructTaskImp::Run()
 
 void CFillWallStructTaskImp::Create()
 {
-    wallstruct = new WallStructure();
+    //the structure and its tree are kept, so a moved wall is searched incrementally
+    if ( ! wallstruct )
+    {
+        wallstruct = new WallStructure();
+    }
+    wallstruct->fc.resize( 0 );
+    wallstruct->fv.resize( 0 );
+    wallfilled = true;
 }
 
 void CFillWallStructTaskImp::FillWall()
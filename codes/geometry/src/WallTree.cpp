@@ -0,0 +1,279 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "WallTree.h"
+#include "HXMath.h"
+#include <algorithm>
+
+BeginNameSpace( ONEFLOW )
+
+const int MAX_LEAF_FACES = 8;
+
+class FaceCenterLess
+{
+public:
+    FaceCenterLess( RealField & faceCenter, int axis ) : faceCenter( faceCenter ), axis( axis ) {}
+    bool operator()( int lhs, int rhs ) const
+    {
+        return faceCenter[ 3 * lhs + axis ] < faceCenter[ 3 * rhs + axis ];
+    }
+public:
+    RealField & faceCenter;
+    int axis;
+};
+
+WallTree::WallTree()
+{
+    wall = 0;
+}
+
+WallTree::~WallTree()
+{
+    ;
+}
+
+void WallTree::Build( WallStructure * wall )
+{
+    this->wall = wall;
+
+    int nWFace = wall->fv.size();
+
+    box.resize( 0 );
+    lChild.resize( 0 );
+    rChild.resize( 0 );
+    faceStart.resize( 0 );
+    faceEnd.resize( 0 );
+
+    faceId.resize( nWFace );
+    faceBox.resize( 6 * nWFace );
+
+    RealField faceCenter( 3 * nWFace );
+
+    for ( int iWFace = 0; iWFace < nWFace; ++ iWFace )
+    {
+        faceId[ iWFace ] = iWFace;
+        this->CalcFaceBox( iWFace );
+        for ( int m = 0; m < 3; ++ m )
+        {
+            faceCenter[ 3 * iWFace + m ] = 0.5 * ( faceBox[ 6 * iWFace + m ] + faceBox[ 6 * iWFace + 3 + m ] );
+        }
+    }
+
+    if ( nWFace == 0 ) return;
+
+    this->BuildNode( 0, nWFace, faceCenter );
+}
+
+void WallTree::CalcFaceBox( int iWFace )
+{
+    WallStructure::PointField & fvList = wall->fv[ iWFace ];
+
+    Real * fbox = & faceBox[ 6 * iWFace ];
+    fbox[ 0 ] = fbox[ 1 ] = fbox[ 2 ] =   LARGE;
+    fbox[ 3 ] = fbox[ 4 ] = fbox[ 5 ] = - LARGE;
+
+    int nVertex = fvList.size();
+    for ( int iv = 0; iv < nVertex; ++ iv )
+    {
+        fbox[ 0 ] = MIN( fbox[ 0 ], fvList[ iv ].x );
+        fbox[ 1 ] = MIN( fbox[ 1 ], fvList[ iv ].y );
+        fbox[ 2 ] = MIN( fbox[ 2 ], fvList[ iv ].z );
+        fbox[ 3 ] = MAX( fbox[ 3 ], fvList[ iv ].x );
+        fbox[ 4 ] = MAX( fbox[ 4 ], fvList[ iv ].y );
+        fbox[ 5 ] = MAX( fbox[ 5 ], fvList[ iv ].z );
+    }
+}
+
+int WallTree::BuildNode( int start, int end, RealField & faceCenter )
+{
+    int iNode = lChild.size();
+
+    lChild.push_back( -1 );
+    rChild.push_back( -1 );
+    faceStart.push_back( start );
+    faceEnd.push_back( end );
+    box.resize( box.size() + 6 );
+
+    Real cmin[ 3 ] = {   LARGE,   LARGE,   LARGE };
+    Real cmax[ 3 ] = { - LARGE, - LARGE, - LARGE };
+
+    for ( int i = start; i < end; ++ i )
+    {
+        int iWFace = faceId[ i ];
+        for ( int m = 0; m < 3; ++ m )
+        {
+            cmin[ m ] = MIN( cmin[ m ], faceCenter[ 3 * iWFace + m ] );
+            cmax[ m ] = MAX( cmax[ m ], faceCenter[ 3 * iWFace + m ] );
+        }
+    }
+
+    if ( end - start > MAX_LEAF_FACES )
+    {
+        //median split along the longest extent of the face centers
+        int axis = 0;
+        for ( int m = 1; m < 3; ++ m )
+        {
+            if ( cmax[ m ] - cmin[ m ] > cmax[ axis ] - cmin[ axis ] ) axis = m;
+        }
+
+        int mid = ( start + end ) / 2;
+        std::nth_element( faceId.begin() + start, faceId.begin() + mid, faceId.begin() + end, FaceCenterLess( faceCenter, axis ) );
+
+        int lNode = this->BuildNode( start, mid, faceCenter );
+        int rNode = this->BuildNode( mid, end, faceCenter );
+        lChild[ iNode ] = lNode;
+        rChild[ iNode ] = rNode;
+    }
+
+    this->RefitNode( iNode );
+
+    return iNode;
+}
+
+void WallTree::Refit()
+{
+    //the topology is kept, only the boxes follow the moved wall vertices
+    int nWFace = wall->fv.size();
+    for ( int iWFace = 0; iWFace < nWFace; ++ iWFace )
+    {
+        this->CalcFaceBox( iWFace );
+    }
+
+    //children are always created after their parent
+    int nNodes = lChild.size();
+    for ( int iNode = nNodes - 1; iNode >= 0; -- iNode )
+    {
+        this->RefitNode( iNode );
+    }
+}
+
+void WallTree::RefitNode( int iNode )
+{
+    Real * nbox = & box[ 6 * iNode ];
+
+    if ( lChild[ iNode ] >= 0 )
+    {
+        Real * lbox = & box[ 6 * lChild[ iNode ] ];
+        Real * rbox = & box[ 6 * rChild[ iNode ] ];
+        for ( int m = 0; m < 3; ++ m )
+        {
+            nbox[ m     ] = MIN( lbox[ m     ], rbox[ m     ] );
+            nbox[ m + 3 ] = MAX( lbox[ m + 3 ], rbox[ m + 3 ] );
+        }
+        return;
+    }
+
+    nbox[ 0 ] = nbox[ 1 ] = nbox[ 2 ] =   LARGE;
+    nbox[ 3 ] = nbox[ 4 ] = nbox[ 5 ] = - LARGE;
+
+    for ( int i = faceStart[ iNode ]; i < faceEnd[ iNode ]; ++ i )
+    {
+        Real * fbox = & faceBox[ 6 * faceId[ i ] ];
+        for ( int m = 0; m < 3; ++ m )
+        {
+            nbox[ m     ] = MIN( nbox[ m     ], fbox[ m     ] );
+            nbox[ m + 3 ] = MAX( nbox[ m + 3 ], fbox[ m + 3 ] );
+        }
+    }
+}
+
+Real WallTree::CalcBoxDist( int iNode, WallStructure::PointType & node )
+{
+    Real * nbox = & box[ 6 * iNode ];
+    Real coor[ 3 ] = { node.x, node.y, node.z };
+
+    Real dist = 0.0;
+    for ( int m = 0; m < 3; ++ m )
+    {
+        Real d = 0.0;
+        if ( coor[ m ] < nbox[ m ] )
+        {
+            d = nbox[ m ] - coor[ m ];
+        }
+        else if ( coor[ m ] > nbox[ m + 3 ] )
+        {
+            d = coor[ m ] - nbox[ m + 3 ];
+        }
+        dist += d * d;
+    }
+    return dist;
+}
+
+Real WallTree::FindNearest( WallStructure::PointType & node, int & wallFaceId )
+{
+    return this->FindNearest( node, wallFaceId, LARGE );
+}
+
+Real WallTree::FindNearest( WallStructure::PointType & node, int & wallFaceId, Real bound )
+{
+    //squared distance to the nearest wall face, only faces closer than bound are searched
+    Real dist = bound;
+    wallFaceId = -1;
+
+    if ( lChild.empty() ) return dist;
+
+    IntField stack;
+    stack.push_back( 0 );
+
+    while ( ! stack.empty() )
+    {
+        int iNode = stack.back();
+        stack.pop_back();
+
+        //the slack keeps round-off in the box distance from pruning a face the exhaustive search would pick
+        if ( this->CalcBoxDist( iNode, node ) > dist * ( 1.0 + 1.0e-10 ) ) continue;
+
+        if ( lChild[ iNode ] < 0 )
+        {
+            for ( int i = faceStart[ iNode ]; i < faceEnd[ iNode ]; ++ i )
+            {
+                int iWFace = faceId[ i ];
+                Real wdst = CalcPoint2FaceDist( node, wall->fv[ iWFace ] );
+                if ( dist > wdst )
+                {
+                    dist = wdst;
+                    wallFaceId = iWFace;
+                }
+            }
+            continue;
+        }
+
+        int lNode = lChild[ iNode ];
+        int rNode = rChild[ iNode ];
+
+        //the nearer child goes on top of the stack
+        if ( this->CalcBoxDist( lNode, node ) < this->CalcBoxDist( rNode, node ) )
+        {
+            stack.push_back( rNode );
+            stack.push_back( lNode );
+        }
+        else
+        {
+            stack.push_back( lNode );
+            stack.push_back( rNode );
+        }
+    }
+
+    return dist;
+}
+
+EndNameSpace
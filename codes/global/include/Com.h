@@ -33,6 +33,7 @@ public:
     void Reverse();
     void CalcTangent();
     void SetGeometry();
+    void SetGeometry( int fId, int cId, int & lc, int & rc );
 public:
     int blank;
     int faceOuterNormal;
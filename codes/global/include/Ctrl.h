@@ -57,6 +57,16 @@ public:
     Real vencat_coef;
     int nrokplus;
     int ivischeme;
+    int nthreads;
+    int fusef2c;
+    int fuserecon;
+    int simdflux;
+    int lusgslevel;
+    int overlapcomm;
+    int parallelio;
+    int asyncdump;
+    int visualformat;
+    int wdstupdate;
     std::string heatfluxFile;
 public:
     void Init();
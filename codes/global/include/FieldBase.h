@@ -34,6 +34,16 @@ void CreateMRField( T * storage, int nEqu, int nSize, const std::string & fieldN
     ONEFLOW::CreateFieldPointer( storage, new DataPointer< MRField >( mrField ), fieldName );
 }
 
+//contiguous field, the layout is chosen per field: FIELD_SOA for face loops, FIELD_AOS for per-cell kernels
+template< typename T >
+void CreateMCField( T * storage, int nEqu, int nSize, int layout, const std::string & fieldName )
+{
+    MCField * mcField = new MCField( nEqu, nSize, layout );
+
+    ONEFLOW::CreateFieldPointer( storage, new DataPointer< MCField >( mcField ), fieldName );
+}
+
 void ZeroField( MRField * field, int nEqu, int nSize );
+void ZeroField( MCField * field, int nEqu, int nSize );
 
 EndNameSpace
@@ -46,6 +46,9 @@ public:
     IFieldProperty();
     ~IFieldProperty();
 public:
+    int sTid;
+public:
+    int GetLayout( const std::string & fieldName );
     void AllocateInterfaceField( int nIFaces, DataStorage * dataStorage );
     void DeAllocateInterfaceField( DataStorage * dataStorage );
     void UploadInterfaceValue();
@@ -101,6 +104,7 @@ public:
     void AddFaceField( const std::string & fieldName, int nEqu, int type );
     void AddBcField( const std::string & fieldName, int nEqu, int type );
 public:
+    int GetLayout( const std::string & fieldName );
     void SetField( const std::string & fieldName, Real value );
     void AllocateInnerAndBcField();
     void AllocateInnerAndBcField( UnsGrid * grid, FieldPropertyData * fieldPropertyData );
@@ -127,8 +131,12 @@ public:
 class UnsGrid;
 void UploadInterfaceValue( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu );
 void DownloadInterfaceValue( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu );
+void UploadInterfaceValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu );
+void DownloadInterfaceValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu );
 void UploadOversetValue( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu );
 void DownloadOversetValue( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu );
+void UploadOversetValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu );
+void DownloadOversetValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu );
 
 void DownloadInterfaceValue_TEST( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu );
 
@@ -32,10 +32,14 @@ public:
     ~FieldRecord();
 public:
     HXVector< MRField * > fields;
+    //one of fields and mcFields is set for each record
+    HXVector< MCField * > mcFields;
     IntField nEquList;
 public:
     void AddField( MRField * field, int nEqu );
+    void AddField( MCField * field, int nEqu );
     MRField * GetField( int id );
+    MCField * GetMCField( int id );
 };
 
 
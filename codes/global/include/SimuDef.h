@@ -36,7 +36,8 @@ enum class TaskEnum
     FUNCTION_TEST = 4,
     SOLVE_THEORY = 5,
     TOY_MODEL = 6,
-    POST_TASK = 7
+    POST_TASK = 7,
+    KERNEL_BENCH = 8
 };
 
 const std::map<std::string, TaskEnum> TaskFilter = 
@@ -48,7 +49,8 @@ const std::map<std::string, TaskEnum> TaskFilter =
     {"FunctionTest",TaskEnum::FUNCTION_TEST},
     {"ToyModel",TaskEnum::TOY_MODEL},
     {"Theory",TaskEnum::SOLVE_THEORY},
-    {"PostTask",TaskEnum::POST_TASK}
+    {"PostTask",TaskEnum::POST_TASK},
+    {"Benchmark",TaskEnum::KERNEL_BENCH}
 };
 
 
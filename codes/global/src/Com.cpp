@@ -39,29 +39,34 @@ GCom::~GCom()
 
 void GCom::SetGeometry()
 {
-    this->xfn   = ( * ug.xfn   )[ ug.fId ];
-    this->yfn   = ( * ug.yfn   )[ ug.fId ];
-    this->zfn   = ( * ug.zfn   )[ ug.fId ];
-    this->vfn   = ( * ug.vfn   )[ ug.fId ];
-    this->farea = ( * ug.farea )[ ug.fId ];
+    this->SetGeometry( ug.fId, ug.cId, ug.lc, ug.rc );
+}
+
+void GCom::SetGeometry( int fId, int cId, int & lc, int & rc )
+{
+    this->xfn   = ( * ug.xfn   )[ fId ];
+    this->yfn   = ( * ug.yfn   )[ fId ];
+    this->zfn   = ( * ug.zfn   )[ fId ];
+    this->vfn   = ( * ug.vfn   )[ fId ];
+    this->farea = ( * ug.farea )[ fId ];
 
     this->swapflag = false;
 
-    if ( ug.rc == ug.cId )
+    if ( rc == cId )
     {
         this->swapflag = true;
 
-        SWAP( ug.lc, ug.rc );
+        SWAP( lc, rc );
         this->Reverse();
     }
 
-    this->xcc2   = ( * ug.xcc )[ ug.rc ];
-    this->ycc2   = ( * ug.ycc )[ ug.rc ];
-    this->zcc2   = ( * ug.zcc )[ ug.rc ];
+    this->xcc2   = ( * ug.xcc )[ rc ];
+    this->ycc2   = ( * ug.ycc )[ rc ];
+    this->zcc2   = ( * ug.zcc )[ rc ];
 
-    this->xcc1   = ( * ug.xcc )[ ug.lc ];
-    this->ycc1   = ( * ug.ycc )[ ug.lc ];
-    this->zcc1   = ( * ug.zcc )[ ug.lc ];
+    this->xcc1   = ( * ug.xcc )[ lc ];
+    this->ycc1   = ( * ug.ycc )[ lc ];
+    this->zcc1   = ( * ug.zcc )[ lc ];
 }
 
 void GCom::Reverse()
@@ -115,9 +120,9 @@ void GCom::CalcTangent()
     this->t1z *= dtmp;
 
     //Get second tangential vector by cross dot t1 to normal
-    gcom.t2x = gcom.yfn * gcom.t1z - gcom.zfn * gcom.t1y;
-    gcom.t2y = gcom.zfn * gcom.t1x - gcom.xfn * gcom.t1z;
-    gcom.t2z = gcom.xfn * gcom.t1y - gcom.yfn * gcom.t1x;
+    this->t2x = this->yfn * this->t1z - this->zfn * this->t1y;
+    this->t2y = this->zfn * this->t1x - this->xfn * this->t1z;
+    this->t2z = this->xfn * this->t1y - this->yfn * this->t1x;
 }
 
 EndNameSpace
@@ -84,6 +84,37 @@ void Ctrl::Init()
     ilim = GetDataValue< int >( "ilim" );
     vencat_coef = GetDataValue< Real >( "vencat_coef" );
 
+    //number of shared memory threads used by the unstructured face loops
+    nthreads = GetDataValueOrDefault< int >( "nthreads", 1 );
+    if ( nthreads < 1 ) nthreads = 1;
+
+    //1: the face fluxes go straight into the cell residual, no face flux arrays are stored
+    fusef2c = GetDataValueOrDefault< int >( "fusef2c", 0 );
+
+    //1: the inviscid faces reconstruct their left and right states inside the flux kernel
+    fuserecon = GetDataValueOrDefault< int >( "fuserecon", 0 );
+
+    //1: Roe and SLAU2 fluxes are evaluated on batches of faces by the vectorized schemes
+    simdflux = GetDataValueOrDefault< int >( "simdflux", 0 );
+
+    //0: classic cell ordered LU-SGS sweeps, 1: level scheduled sweeps shared by the threads
+    lusgslevel = GetDataValueOrDefault< int >( "lusgslevel", 0 );
+
+    //1: the interface halo exchange stays in flight while the residual sums the interior faces
+    overlapcomm = GetDataValueOrDefault< int >( "overlapcomm", 0 );
+
+    //1: binary zone files (restart, wall distance) are written and read by every process with MPI-IO
+    parallelio = GetDataValueOrDefault< int >( "parallelio", 0 );
+
+    //n > 0: the server writes binary zone files on background threads, with at most n files in flight
+    asyncdump = GetDataValueOrDefault< int >( "asyncdump", 0 );
+
+    //0: ascii Tecplot flow file, 1: binary VTK XML pieces per zone with a multiblock index file
+    visualformat = GetDataValueOrDefault< int >( "visualformat", 0 );
+
+    //n > 0: moving walls, the wall distance is searched again every n steps starting from the last nearest faces
+    wdstupdate = GetDataValueOrDefault< int >( "wdstupdate", 0 );
+
     nrokplus = 0;
 }
 
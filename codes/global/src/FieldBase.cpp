@@ -36,4 +36,15 @@ void ZeroField( MRField * field, int nEqu, int nSize )
     }
 }
 
+void ZeroField( MCField * field, int nEqu, int nSize )
+{
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        for ( int iElem = 0; iElem < nSize; ++ iElem )
+        {
+            ( * field )( iEqu, iElem ) = 0;
+        }
+    }
+}
+
 EndNameSpace
@@ -24,6 +24,7 @@ License
 #include "FieldBase.h"
 #include "FieldWrap.h"
 #include "UsdPara.h"
+#include "SolverInfo.h"
 #include "Grid.h"
 #include "GridState.h"
 #include "DataBase.h"
@@ -63,12 +64,19 @@ int FieldProperty::GetNEqu( const std::string & fileName )
 
 IFieldProperty::IFieldProperty()
 {
+    this->sTid = - 1;
 }
 
 IFieldProperty::~IFieldProperty()
 {
 }
 
+int IFieldProperty::GetLayout( const std::string & fieldName )
+{
+    return SolverInfoFactory::GetSolverInfo( this->sTid )->GetFieldLayout( fieldName );
+}
+
+//the buffers take the type and layout of the cell field they carry
 void IFieldProperty::AllocateInterfaceField( int nIFaces, DataStorage * dataStorage )
 {
     if ( nIFaces <= 0 ) return;
@@ -76,11 +84,22 @@ void IFieldProperty::AllocateInterfaceField( int nIFaces, DataStorage * dataStor
     for ( std::map< std::string, int >::iterator iter = this->data.begin(); iter != this->data.end(); ++ iter )
     {
         int nTEqu = iter->second;
+        int layout = this->GetLayout( iter->first );
 
-        ONEFLOW::CreateMRField( dataStorage, nTEqu, nIFaces, iter->first );
+        if ( layout >= 0 )
+        {
+            ONEFLOW::CreateMCField( dataStorage, nTEqu, nIFaces, layout, iter->first );
+
+            MCField * field = ONEFLOW::GetFieldPointer< MCField >( dataStorage, iter->first );
+            ONEFLOW::ZeroField( field, nTEqu, nIFaces );
+        }
+        else
+        {
+            ONEFLOW::CreateMRField( dataStorage, nTEqu, nIFaces, iter->first );
 
-        MRField * field = ONEFLOW::GetFieldPointer< MRField >( dataStorage, iter->first );
-        ONEFLOW::ZeroField( field, nTEqu, nIFaces );
+            MRField * field = ONEFLOW::GetFieldPointer< MRField >( dataStorage, iter->first );
+            ONEFLOW::ZeroField( field, nTEqu, nIFaces );
+        }
     }
 }
 
@@ -101,8 +120,16 @@ void IFieldProperty::UploadInterfaceValue()
                 int kkk = 1;
             }
 
-            MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
-            ONEFLOW::UploadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            if ( this->GetLayout( iter->first ) >= 0 )
+            {
+                MCField * targetField = ONEFLOW::GetFieldPointer< MCField >( grid, iter->first );
+                ONEFLOW::UploadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            }
+            else
+            {
+                MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
+                ONEFLOW::UploadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            }
         }
     }
 }
@@ -119,9 +146,16 @@ void IFieldProperty::DownloadInterfaceValue()
         {
             int nEqu = iter->second;
 
-            MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
-
-            ONEFLOW::DownloadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            if ( this->GetLayout( iter->first ) >= 0 )
+            {
+                MCField * targetField = ONEFLOW::GetFieldPointer< MCField >( grid, iter->first );
+                ONEFLOW::DownloadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            }
+            else
+            {
+                MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
+                ONEFLOW::DownloadInterfaceValue( grid, targetField, iter->first,  nEqu );
+            }
         }
     }
 }
@@ -138,9 +172,16 @@ void IFieldProperty::UploadOversetInterfaceValue()
         {
             int nEqu = iter->second;
 
-            MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
-
-            ONEFLOW::UploadOversetValue( grid, targetField, iter->first,  nEqu );
+            if ( this->GetLayout( iter->first ) >= 0 )
+            {
+                MCField * targetField = ONEFLOW::GetFieldPointer< MCField >( grid, iter->first );
+                ONEFLOW::UploadOversetValue( grid, targetField, iter->first,  nEqu );
+            }
+            else
+            {
+                MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
+                ONEFLOW::UploadOversetValue( grid, targetField, iter->first,  nEqu );
+            }
         }
     }
 }
@@ -157,9 +198,16 @@ void IFieldProperty::DownloadOversetInterfaceValue()
         {
             int nEqu = iter->second;
 
-            MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
-
-            ONEFLOW::DownloadOversetValue( grid, targetField, iter->first, nEqu );
+            if ( this->GetLayout( iter->first ) >= 0 )
+            {
+                MCField * targetField = ONEFLOW::GetFieldPointer< MCField >( grid, iter->first );
+                ONEFLOW::DownloadOversetValue( grid, targetField, iter->first, nEqu );
+            }
+            else
+            {
+                MRField * targetField = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
+                ONEFLOW::DownloadOversetValue( grid, targetField, iter->first, nEqu );
+            }
         }
     }
 }
@@ -231,10 +279,22 @@ FieldManager::~FieldManager()
     delete commManager;
 }
 
+int FieldManager::GetLayout( const std::string & fieldName )
+{
+    return this->iFieldProperty->GetLayout( fieldName );
+}
+
 void FieldManager::SetField( const std::string & fieldName, Real value )
 {
     int nTEqu = this->commManager->innerField->GetNEqu( fieldName );
 
+    if ( this->GetLayout( fieldName ) >= 0 )
+    {
+        MCField * field = ONEFLOW::GetFieldPointer< MCField >( Zone::GetGrid(), fieldName );
+        * field = value;
+        return;
+    }
+
     FieldHome::SetField( fieldName, value );
 }
 
@@ -334,11 +394,22 @@ void FieldManager::AllocateInnerField( UnsGrid * grid, FieldPropertyData * field
     for ( std::map< std::string, int >::iterator iter = data.begin(); iter != data.end(); ++ iter )
     {
         int nTEqu = iter->second;
+        int layout = this->GetLayout( iter->first );
 
-        ONEFLOW::CreateMRField( grid, nTEqu, nTCell, iter->first );
+        if ( layout >= 0 )
+        {
+            ONEFLOW::CreateMCField( grid, nTEqu, nTCell, layout, iter->first );
 
-        MRField * field = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
-        ONEFLOW::ZeroField( field, nTEqu, nTCell );
+            MCField * field = ONEFLOW::GetFieldPointer< MCField >( grid, iter->first );
+            ONEFLOW::ZeroField( field, nTEqu, nTCell );
+        }
+        else
+        {
+            ONEFLOW::CreateMRField( grid, nTEqu, nTCell, iter->first );
+
+            MRField * field = ONEFLOW::GetFieldPointer< MRField >( grid, iter->first );
+            ONEFLOW::ZeroField( field, nTEqu, nTCell );
+        }
     }
 }
 
@@ -403,6 +474,7 @@ void FieldFactory::AddFieldManager( int sTid )
     if ( iter == FieldFactory::data->end() )
     {
         FieldManager * fieldManager = new FieldManager();
+        fieldManager->iFieldProperty->sTid = sTid;
         ( * FieldFactory::data )[ sTid ] = fieldManager;
     }
 }
@@ -480,6 +552,61 @@ void DownloadInterfaceValue( UnsGrid * grid, MRField * field2D, const std::strin
     }
 }
 
+void UploadInterfaceValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu )
+{
+    InterFace * interFace = grid->interFace;
+    if ( ! ONEFLOW::IsValid( interFace ) ) return;
+
+    int nIFaces = interFace->nIFaces;
+
+    if ( field2D == 0 ) return;
+
+    for ( int ghostId = MAX_GHOST_LEVELS - 1; ghostId >= 0; -- ghostId )
+    {
+        DataStorage * dataSend = interFace->dataSend[ ghostId ];
+
+        MCField * fieldStorage = ONEFLOW::GetFieldPointer< MCField >( dataSend, name );
+
+        for ( int iFace = 0; iFace < nIFaces; ++ iFace )
+        {
+            int iCell;
+            grid->faceTopo->GetSId( iFace, ghostId + 1, iCell );
+
+            for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+            {
+                ( * fieldStorage )( iEqu, iFace ) = ( * field2D )( iEqu, iCell );
+            }
+        }
+    }
+}
+
+void DownloadInterfaceValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu )
+{
+    InterFace * interFace = grid->interFace;
+    if ( ! ONEFLOW::IsValid( interFace ) ) return;
+
+    if ( field2D == 0 ) return;
+
+    for ( int ghostId = MAX_GHOST_LEVELS - 1; ghostId >= 0; -- ghostId )
+    {
+        DataStorage * dataRecv = interFace->dataRecv[ ghostId ];
+
+        MCField * fieldStorage = ONEFLOW::GetFieldPointer< MCField >( dataRecv, name );
+
+        int nIFaces = interFace->nIFaces;
+        for ( int iFace = 0; iFace < nIFaces; ++ iFace )
+        {
+            int iCell;
+            grid->faceTopo->GetTId( iFace, ghostId + 1, iCell );
+
+            for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+            {
+                ( * field2D )( iEqu, iCell ) = ( * fieldStorage )( iEqu, iFace );
+            }
+        }
+    }
+}
+
 void DownloadInterfaceValue_TEST( UnsGrid * grid, MRField * field2D, const std::string & name, int nEqu )
 {
     InterFace * interFace = grid->interFace;
@@ -519,4 +646,12 @@ void DownloadOversetValue( UnsGrid * grid, MRField * field2D, const std::string
 {
 }
 
+void UploadOversetValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu )
+{
+}
+
+void DownloadOversetValue( UnsGrid * grid, MCField * field2D, const std::string & name, int nEqu )
+{
+}
+
 EndNameSpace
@@ -35,6 +35,14 @@ void FieldRecord::AddField( MRField * field, int nEqu )
 {
     this->nEquList.push_back( nEqu );
     this->fields.push_back( field );
+    this->mcFields.push_back( 0 );
+}
+
+void FieldRecord::AddField( MCField * field, int nEqu )
+{
+    this->nEquList.push_back( nEqu );
+    this->fields.push_back( 0 );
+    this->mcFields.push_back( field );
 }
 
 MRField * FieldRecord::GetField( int id )
@@ -42,5 +50,10 @@ MRField * FieldRecord::GetField( int id )
     return this->fields[ id ];
 }
 
+MCField * FieldRecord::GetMCField( int id )
+{
+    return this->mcFields[ id ];
+}
+
 
 EndNameSpace
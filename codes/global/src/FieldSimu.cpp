@@ -29,6 +29,7 @@ License
 #include "CmxTask.h"
 #include "Multigrid.h"
 #include "BcData.h"
+#include "AsyncFileWriter.h"
 #include <iostream>
 
 
@@ -42,6 +43,7 @@ void FieldSimu()
     SolverMap::CreateSolvers();
     InitializeSolver();
     MultigridSolve();
+    AsyncFileWriter::WaitAll();
 }
 
 void InitFlowSimuGlobal()
@@ -28,6 +28,7 @@ License
 #include "TaskRegister.h"
 #include "Iteration.h"
 #include "FileUtil.h"
+#include "Ctrl.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -49,6 +50,12 @@ std::string GetParallelFileName( const std::string & fileNameVar )
         {
             fileName = AddSymbolToFileName( fileName, Iteration::outerSteps );
         }
+
+        //the binary pieces are listed by a VTK multiblock index in place of the Tecplot file
+        if ( ctrl.visualformat == 1 )
+        {
+            ONEFLOW::ModifyFileExtensionName( fileName, "vtm" );
+        }
     }
     return fileName;
 }
@@ -27,6 +27,7 @@ License
 #include "RegisterUtil.h"
 #include "SolverInfo.h"
 #include "SolverName.h"
+#include "TaskGraph.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -68,6 +69,7 @@ void RegisterSolverFunc( int sTid, const std::string & solverName, VoidFunc func
 
 void FreeSolverTask()
 {
+    TaskGraph::Free();
     RegisterFactory::FreeMRegister();
     Category::Free();
     VarNameFactory::FreeVarNameSolver();
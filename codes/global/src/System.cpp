@@ -25,6 +25,7 @@ License
 #include "SolverDef.h"
 #include "TaskRegister.h"
 #include "MsgMapImp.h"
+#include "TaskGraph.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -39,6 +40,8 @@ void ConstructSystemMap()
     CreateMsgMap();
 
     SolverRegister::Run();
+
+    TaskGraph::Compile();
 }
 
 EndNameSpace
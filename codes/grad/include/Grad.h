@@ -42,6 +42,7 @@ public:
 public:
     virtual void Init(){};
     void CalcGrad();
+    void CalcGradOverlap();
     void CalcGradDebug();
     void SwapBcGrad();
     void StoreBcGrad();
@@ -34,6 +34,7 @@ License
 #include "Iteration.h"
 #include "DataBase.h"
 #include "StrUtil.h"
+#include "InterField.h"
 #include <iostream>
 #include <iomanip>
 
@@ -52,9 +53,16 @@ Grad::~Grad()
 
 void Grad::CalcGrad()
 {
-    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    if ( ONEFLOW::InterfaceDataPending() )
     {
-        ONEFLOW::CalcGradGGCellWeight( ( * q )[ iEqu ], ( * dqdx )[ iEqu ], ( * dqdy )[ iEqu ], ( * dqdz )[ iEqu ] );
+        this->CalcGradOverlap();
+    }
+    else
+    {
+        for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            ONEFLOW::CalcGradGGCellWeight( ( * q )[ iEqu ], ( * dqdx )[ iEqu ], ( * dqdy )[ iEqu ], ( * dqdz )[ iEqu ] );
+        }
     }
 
     if ( Iteration::outerSteps == -31 )
@@ -87,6 +95,26 @@ void Grad::CalcGrad()
     this->SwapBcGrad();
 }
 
+void Grad::CalcGradOverlap()
+{
+    //the interior faces of all equations are summed while the halo messages are in flight
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        ( * dqdx )[ iEqu ] = 0;
+        ( * dqdy )[ iEqu ] = 0;
+        ( * dqdz )[ iEqu ] = 0;
+        ONEFLOW::CalcGradGGCellWeight( ( * q )[ iEqu ], ( * dqdx )[ iEqu ], ( * dqdy )[ iEqu ], ( * dqdz )[ iEqu ], * ug.innerFaces );
+    }
+
+    ONEFLOW::FinishInterfaceData();
+
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        ONEFLOW::CalcGradGGCellWeight( ( * q )[ iEqu ], ( * dqdx )[ iEqu ], ( * dqdy )[ iEqu ], ( * dqdz )[ iEqu ], * ug.haloFaces );
+        ONEFLOW::FinishGradGGCellWeight( ( * dqdx )[ iEqu ], ( * dqdy )[ iEqu ], ( * dqdz )[ iEqu ] );
+    }
+}
+
 void Grad::CalcGradDebug()
 {
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
@@ -34,6 +34,7 @@ public:
     virtual void LowerSweep(){};
     virtual void UpperSweep(){};
     virtual void Initialize(){};
+    virtual void ResetOperator(){};
 };
 
 class LusgsPair
@@ -39,12 +39,6 @@ const int _ISCHEME_AUSMPW         = 10;
 const int _ISCHEME_HYBRIDROE      = 11;
 const int _ISCHEME_SLAU2          = 12;
 
-
-Real FMSplit1( const Real & mach, const Real & ipn );
-Real FMSplit2( const Real & mach, const Real & ipn );
-Real FMSplit4( const Real & mach, const Real & beta , const Real & ipn );
-Real FPSplit5( const Real & mach, const Real & alpha, const Real & ipn );
-
 class INsInv
 {
 public:
@@ -34,13 +34,18 @@ class FieldRecord;
 
 DataStorage * GetInterfaceDataStorage( InterFace * interFace, int srFlag, int ghostId );
 void GetInterfaceDataStorageList( HXVector< DataStorage * > * iDataStorageList, int srFlag );
-void AddFieldRecord( FieldRecord * fieldRecord, DataStorage * dataStorage, StringField & fieldNameList );
+void AddFieldRecord( int sTid, FieldRecord * fieldRecord, DataStorage * dataStorage, StringField & fieldNameList );
 void PrepareInterfaceFieldRecord( int sTid, int iFk, int iSr, FieldRecord * fieldRecord );
 void SetInterfaceFieldData( int iSr, FieldRecord * fieldRecord );
 
 void HXWriteSubData( DataBook * dataBook, MRField * field2D, IntField & idMap );
 void HXWriteSubData( DataBook * dataBook, RealField & field, IntField & idMap );
 void HXReadSubData( DataBook * dataBook, MRField * field2D, IntField & idMap );
+void HXWriteSubData( DataBook * dataBook, MCField * field2D, IntField & idMap );
+void HXReadSubData( DataBook * dataBook, MCField * field2D, IntField & idMap );
 void HXReadSubData( DataBook * dataBook, RealField & field, IntField & idMap );
 
+bool InterfaceDataPending();
+void FinishInterfaceData();
+
 EndNameSpace
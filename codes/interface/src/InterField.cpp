@@ -33,6 +33,9 @@ License
 #include "DataStorage.h"
 #include "ActionState.h"
 #include "FieldImp.h"
+#include "InterfaceTask.h"
+#include "SolverInfo.h"
+#include <cstring>
 
 BeginNameSpace( ONEFLOW )
 
@@ -52,7 +55,7 @@ void PrepareInterfaceFieldRecord( int sTid, int iFk, int iSr, FieldRecord * fiel
     for ( int dataId = 0; dataId < iDataStorageList->size(); ++ dataId )
     {
         DataStorage * dataStorage = ( * iDataStorageList )[ dataId ];
-        AddFieldRecord( fieldRecord, dataStorage, varNameSolver->data );
+        AddFieldRecord( sTid, fieldRecord, dataStorage, varNameSolver->data );
     }
 
     delete iDataStorageList;
@@ -84,14 +87,23 @@ DataStorage * GetInterfaceDataStorage( InterFace * interFace, int srFlag, int gh
     }
 }
 
-void AddFieldRecord( FieldRecord * fieldRecord, DataStorage * dataStorage, StringField & fieldNameList )
+void AddFieldRecord( int sTid, FieldRecord * fieldRecord, DataStorage * dataStorage, StringField & fieldNameList )
 {
+    SolverInfo * solverInfo = SolverInfoFactory::GetSolverInfo( sTid );
     for ( int iField = 0; iField < fieldNameList.size(); ++ iField )
     {
         std::string & filedName = fieldNameList[ iField ];
-        MRField * field = ONEFLOW::GetFieldPointer< MRField >( dataStorage, filedName );
         int nEqu = GFieldProperty::GetNEqu( filedName );
-        fieldRecord->AddField( field , nEqu );
+        if ( solverInfo->GetFieldLayout( filedName ) >= 0 )
+        {
+            MCField * field = ONEFLOW::GetFieldPointer< MCField >( dataStorage, filedName );
+            fieldRecord->AddField( field , nEqu );
+        }
+        else
+        {
+            MRField * field = ONEFLOW::GetFieldPointer< MRField >( dataStorage, filedName );
+            fieldRecord->AddField( field , nEqu );
+        }
     }
 }
 
@@ -118,13 +130,28 @@ void SetInterfaceFieldData( int iSr, FieldRecord * fieldRecord )
     {
         int nEqu = fieldRecord->nEquList[ fieldId ];
         MRField * field  = fieldRecord->GetField( fieldId );
+        MCField * mcField = fieldRecord->GetMCField( fieldId );
         if ( iSr == GREAT_SEND )
         {
-            HXWriteSubData( ActionState::dataBook, field, interfaceId );
+            if ( mcField )
+            {
+                HXWriteSubData( ActionState::dataBook, mcField, interfaceId );
+            }
+            else
+            {
+                HXWriteSubData( ActionState::dataBook, field, interfaceId );
+            }
         }
         else
         {
-            HXReadSubData( ActionState::dataBook, field, interfaceId );
+            if ( mcField )
+            {
+                HXReadSubData( ActionState::dataBook, mcField, interfaceId );
+            }
+            else
+            {
+                HXReadSubData( ActionState::dataBook, field, interfaceId );
+            }
         }
         
     }
@@ -143,6 +170,19 @@ void HXWriteSubData( DataBook * dataBook, RealField & field, IntField & idMap )
 {
     int nElem = idMap.size();
     if ( nElem <= 0 ) return;
+
+    //gather straight from the field into the message
+    char * data = static_cast< char * >( dataBook->WriteSpace( nElem * sizeof( Real ) ) );
+    if ( data )
+    {
+        for ( int iElem = 0; iElem < nElem; ++ iElem )
+        {
+            int id = idMap[ iElem ];
+            memcpy( data + iElem * sizeof( Real ), & field[ id ], sizeof( Real ) );
+        }
+        return;
+    }
+
     RealField swapField( nElem );
     for ( int iElem = 0; iElem < nElem; ++ iElem )
     {
@@ -165,6 +205,19 @@ void HXReadSubData( DataBook * dataBook, RealField & field, IntField & idMap )
 {
     int nElem = idMap.size();
     if ( nElem <= 0 ) return;
+
+    //scatter straight from the message into the field
+    char * data = static_cast< char * >( dataBook->ReadSpace( nElem * sizeof( Real ) ) );
+    if ( data )
+    {
+        for ( int iElem = 0; iElem < nElem; ++ iElem )
+        {
+            int id = idMap[ iElem ];
+            memcpy( & field[ id ], data + iElem * sizeof( Real ), sizeof( Real ) );
+        }
+        return;
+    }
+
     RealField swapField( nElem );
     HXRead( dataBook, swapField );
 
@@ -175,5 +228,108 @@ void HXReadSubData( DataBook * dataBook, RealField & field, IntField & idMap )
     }
 }
 
+//the message holds the nEqu values of each interface face in turn, one block copy for FIELD_AOS
+void HXWriteSubData( DataBook * dataBook, MCField * field2D, IntField & idMap )
+{
+    int nElem = idMap.size();
+    if ( nElem <= 0 ) return;
+
+    int nEqu = field2D->GetNEqu();
+    int blockSize = nEqu * sizeof( Real );
+
+    char * data = static_cast< char * >( dataBook->WriteSpace( nElem * blockSize ) );
+    if ( data && field2D->GetLayout() == FIELD_AOS )
+    {
+        for ( int iElem = 0; iElem < nElem; ++ iElem )
+        {
+            memcpy( data + iElem * blockSize, field2D->GetCell( idMap[ iElem ] ), blockSize );
+        }
+        return;
+    }
+
+    RealField swapField( nElem * nEqu );
+    for ( int iElem = 0; iElem < nElem; ++ iElem )
+    {
+        int id = idMap[ iElem ];
+        for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            swapField[ iElem * nEqu + iEqu ] = ( * field2D )( iEqu, id );
+        }
+    }
+
+    if ( data )
+    {
+        memcpy( data, & swapField[ 0 ], nElem * blockSize );
+        return;
+    }
+    HXWrite( dataBook, swapField );
+}
+
+void HXReadSubData( DataBook * dataBook, MCField * field2D, IntField & idMap )
+{
+    int nElem = idMap.size();
+    if ( nElem <= 0 ) return;
+
+    int nEqu = field2D->GetNEqu();
+    int blockSize = nEqu * sizeof( Real );
+
+    char * data = static_cast< char * >( dataBook->ReadSpace( nElem * blockSize ) );
+    if ( data && field2D->GetLayout() == FIELD_AOS )
+    {
+        for ( int iElem = 0; iElem < nElem; ++ iElem )
+        {
+            memcpy( field2D->GetCell( idMap[ iElem ] ), data + iElem * blockSize, blockSize );
+        }
+        return;
+    }
+
+    RealField swapField( nElem * nEqu );
+    if ( data )
+    {
+        memcpy( & swapField[ 0 ], data, nElem * blockSize );
+    }
+    else
+    {
+        HXRead( dataBook, swapField );
+    }
+
+    for ( int iElem = 0; iElem < nElem; ++ iElem )
+    {
+        int id = idMap[ iElem ];
+        for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            ( * field2D )( iEqu, id ) = swapField[ iElem * nEqu + iEqu ];
+        }
+    }
+}
+
+bool InterfaceDataPending()
+{
+    return InterfaceExchange::GetPending( SolverState::tid ) != 0;
+}
+
+void FinishInterfaceData()
+{
+    if ( ! ONEFLOW::InterfaceDataPending() ) return;
+
+    int sTid = SolverState::tid;
+    int saveZid = ZoneState::zid;
+
+    InterfaceExchange::FinishPending( sTid );
+
+    //what DOWNLOAD_INTERFACE_DATA would have done right after the exchange
+    FieldManager * fieldManager = FieldFactory::GetFieldManager( sTid );
+
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+
+        fieldManager->iFieldProperty->DownloadInterfaceValue();
+    }
+
+    ZoneState::zid = saveZid;
+}
 
 EndNameSpace
@@ -23,6 +23,7 @@ License
 
 #pragma once
 #include "Configure.h"
+#include "BasicParallel.h"
 #include <fstream>
 #include <string>
 
@@ -40,6 +41,10 @@ public:
 
     static void CloseFile( std::fstream & file );
     static void CloseFile();
+
+    static std::string GetTaskPrjFileName();
+    static void ParallelOpenPrjFile( PL_File * file, bool writeFlag );
+    static void ParallelCloseFile( PL_File * file );
 };
 
 
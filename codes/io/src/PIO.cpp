@@ -76,5 +76,35 @@ void PIO::CloseFile( std::fstream & file )
     Prj::CloseFile( file );
 }
 
+std::string PIO::GetTaskPrjFileName()
+{
+    ONEFLOW::StrIO.ClearAll();
+    ONEFLOW::StrIO << Prj::prjBaseDir << TaskState::task->fileInfo->fileName;
+
+    return ONEFLOW::StrIO.str();
+}
+
+void PIO::ParallelOpenPrjFile( PL_File * file, bool writeFlag )
+{
+    std::string prjFileName = PIO::GetTaskPrjFileName();
+
+    //all processes open the same file, only the file server creates its directory
+    if ( writeFlag )
+    {
+        if ( Parallel::pid == Parallel::GetFid() )
+        {
+            Prj::CreateDirIfNeeded( prjFileName );
+        }
+        ONEFLOW::HXBarrier();
+    }
+
+    ONEFLOW::HXFileOpen( file, prjFileName, writeFlag );
+}
+
+void PIO::ParallelCloseFile( PL_File * file )
+{
+    ONEFLOW::HXFileClose( file );
+}
+
 
 EndNameSpace
@@ -32,6 +32,8 @@ License
 #include "Test.h"
 #include "Theory.h"
 #include "PostProcess.h"
+#include "Profiler.h"
+#include "KernelBench.h"
 #include <iostream>
 
 
@@ -66,6 +68,7 @@ void SimuImp::MainProcess()
 
 void SimuImp::PostProcess()
 {
+    Profiler::Report();
     HXFinalize();
 }
 
@@ -79,7 +82,8 @@ void SimuImp::RunSimu()
 
     if ( task == TaskEnum::SOLVE_FIELD ||
          task == TaskEnum::CREATE_GRID ||
-         task == TaskEnum::CREATE_WALL_DIST
+         task == TaskEnum::CREATE_WALL_DIST ||
+         task == TaskEnum::KERNEL_BENCH
        )
     {
         ConstructSystemMap();
@@ -109,6 +113,9 @@ void SimuImp::RunSimu()
         case TaskEnum::POST_TASK:
             PostSimu();
             break;
+        case TaskEnum::KERNEL_BENCH:
+            BenchSimu();
+            break;
         default:
         {
             std::cerr << "unknown simutask value!!" << std::endl;
@@ -123,6 +130,7 @@ void SimuImp::InitSimu()
     std::cout << " OneFLOW is running\n";
     ONEFLOW::SetUpParallelEnvironment();
     ONEFLOW::ReadControlInfo();
+    Profiler::Init();
 }
 
 
@@ -36,6 +36,7 @@ License
 #include "CmxTask.h"
 #include "BgField.h"
 #include "TimeSpan.h"
+#include "MultiBlock.h"
 #include <iostream>
 
 
@@ -139,6 +140,8 @@ void MG::Run()
 				Iteration::outerSteps++;
 				Iteration::innerSteps++;
 
+				MultiBlock::UpdateFlowWallDist();
+
 				this->SolveInnerIter();
 
 			}
@@ -154,6 +157,8 @@ void MG::Run()
 			Iteration::outerSteps ++;
 			ctrl.currTime += ctrl.pdt;
 
+			MultiBlock::UpdateFlowWallDist();
+
 			//Inner loop
 			Iteration::innerSteps = 0;
 			while ( !SolverState::Converge() )
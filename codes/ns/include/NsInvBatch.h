@@ -0,0 +1,57 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+BeginNameSpace( ONEFLOW )
+
+//number of faces evaluated together by the batch flux schemes, 8 doubles fill an AVX-512 register
+const int NS_BATCH = 8;
+const int NS_BATCH_NEQU = 5;
+
+//Face states of one batch stored by equation, so every scheme loop runs over the faces of the batch
+class NsInvBatch
+{
+public:
+    NsInvBatch();
+    ~NsInvBatch();
+public:
+    int nFace;
+    int fId[ NS_BATCH ];
+    Real xfn[ NS_BATCH ], yfn[ NS_BATCH ], zfn[ NS_BATCH ], vfn[ NS_BATCH ];
+    Real gama1[ NS_BATCH ], gama2[ NS_BATCH ];
+    Real prim1[ NS_BATCH_NEQU ][ NS_BATCH ];
+    Real prim2[ NS_BATCH_NEQU ][ NS_BATCH ];
+    Real flux [ NS_BATCH_NEQU ][ NS_BATCH ];
+public:
+    void FillEmptyLanes();
+};
+
+typedef void ( * InvFluxBatchPointer )( NsInvBatch & batch );
+
+//The batch schemes repeat the arithmetic of NsInvFlux::Roe and NsInvFlux::Slau2 operation by operation,
+//they only cover the five perfect gas equations
+void RoeBatch  ( NsInvBatch & batch );
+void Slau2Batch( NsInvBatch & batch );
+InvFluxBatchPointer GetInvFluxBatch( int schemeId );
+
+EndNameSpace
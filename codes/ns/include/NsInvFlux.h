@@ -39,12 +39,6 @@ const int ISCHEME_AUSMPW         = 10;
 const int ISCHEME_HYBRIDROE      = 11;
 const int ISCHEME_SLAU2          = 12;
 
-
-Real FMSplit1( const Real & mach, const Real & ipn );
-Real FMSplit2( const Real & mach, const Real & ipn );
-Real FMSplit4( const Real & mach, const Real & beta , const Real & ipn );
-Real FPSplit5( const Real & mach, const Real & alpha, const Real & ipn );
-
 class NsInv
 {
 public:
@@ -78,40 +72,38 @@ public:
 
 extern NsInv inv;
 
+class GCom;
+
+//The schemes read the face states from inv and the face geometry from gcom,
+//both are passed in so that every thread can evaluate fluxes on its own face context,
+//the scheme bodies are inline in NsInvFluxImp.h
 class NsInvFlux
 {
 public:
     NsInvFlux ();
     ~NsInvFlux();
 public:
-    typedef void ( NsInvFlux:: * InvFluxPointer )();
+    typedef void ( NsInvFlux:: * InvFluxPointer )( NsInv & inv, GCom & gcom );
 public:
     void Solve();
 public:
-    void SetPointer( int schemeIndex );
-    InvFluxPointer invFluxPointer;
-public:
-    void Roe      ();
-    void RoeOld   (){};
-    void HybridRoe(){};
-    void Vanleer  ();
-    void Steger   ();
-    void Hlle     ();
-    void LaxFriedrichs();
-    void Ausmp    ();
-    void AusmpUp  ();
-    void Ausmdv   ();
-    void Ausmw    ();
-    void Ausmpw   ();
-    void Slau2();
+    void Roe      ( NsInv & inv, GCom & gcom );
+    void RoeOld   ( NsInv &, GCom & ){};
+    void HybridRoe( NsInv &, GCom & ){};
+    void Vanleer  ( NsInv & inv, GCom & gcom );
+    void Steger   ( NsInv & inv, GCom & gcom );
+    void Hlle     ( NsInv & inv, GCom & gcom );
+    void LaxFriedrichs( NsInv & inv, GCom & gcom );
+    void Ausmp    ( NsInv & inv, GCom & gcom );
+    void AusmpUp  ( NsInv & inv, GCom & gcom );
+    void Ausmdv   ( NsInv & inv, GCom & gcom );
+    void Ausmw    ( NsInv & inv, GCom & gcom );
+    void Ausmpw   ( NsInv & inv, GCom & gcom );
+    void Slau2    ( NsInv & inv, GCom & gcom );
 public:
-    void ModifyAbsoluteEigenvalue();
+    void ModifyAbsoluteEigenvalue( NsInv & inv );
 };
 
-void CalcEnthalpy( RealField & prim, Real gama, Real & enthalpy );
-void CalcTotalEnthalpyChange( RealField & prim, Real & gama, RealField & dq, Real & dh );
-void PrimToQ( RealField & prim, Real gama, RealField & q );
 void QToPrim( RealField & q, Real gama, RealField & prim, RealField & temp );
-void CalcInternalEnergy( RealField & prim, Real gama, Real & em );
 
 EndNameSpace
@@ -23,6 +23,8 @@ License
 
 #pragma once
 #include "Lusgs.h"
+#include "HXArray.h"
+#include "Com.h"
 BeginNameSpace( ONEFLOW )
 
 class LusgsData
@@ -60,6 +62,12 @@ public:
     RealField drhs;   //For nsweep > 1
     RealField rhs ;   //Of the equation at time nRight end item
     RealField tmp; //Temporary array
+public:
+    //cell and face being solved, every thread of the level scheduled sweeps owns its copy
+    int  cId, fId, lc, rc;
+    GCom gcom;
+    Real visl, vist, vissr;
+    RealField q1, q2;
 };
 
 extern LusgsData nslu;
@@ -73,20 +81,20 @@ public:
     void InitializeSub();
 public:
     void DumpSweepInformation();
-    void ZeroFluxIncrement   ();
-    void AddViscousTerm      ();
-    void AddFluxIncrement    ();
-    void AddFluxIncrement( const Real & coef );
-    void GetFluxIncrement( int signOfMatrix );
-    void CalcFaceEigenValue( RealField & prim );
-    void GetStandardFluxIncrement( int signOfMatrix );
+    void ZeroFluxIncrement   ( LusgsData & nslu );
+    void AddViscousTerm      ( LusgsData & nslu );
+    void AddFluxIncrement    ( LusgsData & nslu );
+    void AddFluxIncrement( LusgsData & nslu, const Real & coef );
+    void GetFluxIncrement( LusgsData & nslu, int signOfMatrix );
+    void CalcFaceEigenValue( LusgsData & nslu, RealField & prim );
+    void GetStandardFluxIncrement( LusgsData & nslu, int signOfMatrix );
     void InitializeSweep( int iSweep );
     bool UpdateSweep    ( int iSweep );
 public:
-    void CalcLowerChange();
-    void CalcUpperChange();
-    bool IsOversetCell  ();
-    void ZeroOversetCell();
+    void CalcLowerChange( LusgsData & nslu );
+    void CalcUpperChange( LusgsData & nslu );
+    bool IsOversetCell  ( LusgsData & nslu );
+    void ZeroOversetCell( LusgsData & nslu );
 };
 
 void CalcDH( RealField & prim, Real & gama, RealField & dq, Real & dh, Real & totalEnthalpy );
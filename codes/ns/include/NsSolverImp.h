@@ -38,6 +38,7 @@ DEFINE_DATA_CLASS( NsCalcBoundary );
 DEFINE_DATA_CLASS( DumpHeatFluxCoeff );
 
 void RegisterNsFunc();
+bool NsOverlapInterfaceData();
 
 class SolverRegData;
 SolverRegData * GetNsReg();
@@ -24,6 +24,7 @@ License
 #pragma once
 #include "HXDefine.h"
 #include "VisGrad.h"
+#include "Com.h"
 BeginNameSpace( ONEFLOW )
 
 class NsVis
@@ -56,24 +57,44 @@ public:
 
 extern NsVis vis;
 
+//Working data of one face in the viscous flux loop, each thread owns one
+class NsVisFace
+{
+public:
+    NsVisFace();
+    ~NsVisFace();
+public:
+    void Init();
+public:
+    int fId, lc, rc;
+    NsVis vis;
+    VisGrad visQ, visT;
+    VisGradGeom vgg;
+    GCom gcom;
+public:
+    Real visl1, visl2, visl;
+    Real vist1, vist2, vist;
+    Real vism, kcp;
+};
+
 class NsVisFlux
 {
 public:
     NsVisFlux ();
     ~NsVisFlux();
 public:
-    void AverGrad();
-    void ZeroNormalGrad();
-    void AverFaceValue();
-    void AverOtherFaceValue();
-    void AccurateFaceValue();
-    void AccurateOtherFaceValue();
-    void CorrectFaceGrad();
-    void CalcNormalGrad();
-    void CalcTestMethod();
-    void CalcNew1Method();
-    void CalcNew2Method();
-    void ModifyFaceGrad();
+    void AverGrad( NsVisFace & face );
+    void ZeroNormalGrad( NsVisFace & face );
+    void AverFaceValue( NsVisFace & face );
+    void AverOtherFaceValue( NsVisFace & face );
+    void AccurateFaceValue( NsVisFace & face );
+    void AccurateOtherFaceValue( NsVisFace & face );
+    void CorrectFaceGrad( NsVisFace & face );
+    void CalcNormalGrad( NsVisFace & face );
+    void CalcTestMethod( NsVisFace & face );
+    void CalcNew1Method( NsVisFace & face );
+    void CalcNew2Method( NsVisFace & face );
+    void ModifyFaceGrad( NsVisFace & face );
 };
 
 extern VisGrad visQ;
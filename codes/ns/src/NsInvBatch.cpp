@@ -0,0 +1,307 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "NsInvBatch.h"
+#include "NsInvFlux.h"
+#include "NsCom.h"
+#include "NsIdx.h"
+#include "HXMath.h"
+#include "Ctrl.h"
+
+BeginNameSpace( ONEFLOW )
+
+NsInvBatch::NsInvBatch()
+{
+    nFace = 0;
+}
+
+NsInvBatch::~NsInvBatch()
+{
+    ;
+}
+
+void NsInvBatch::FillEmptyLanes()
+{
+    //the unused lanes of the last batch repeat the first face, so they never produce nan
+    for ( int i = nFace; i < NS_BATCH; ++ i )
+    {
+        fId  [ i ] = fId  [ 0 ];
+        xfn  [ i ] = xfn  [ 0 ];
+        yfn  [ i ] = yfn  [ 0 ];
+        zfn  [ i ] = zfn  [ 0 ];
+        vfn  [ i ] = vfn  [ 0 ];
+        gama1[ i ] = gama1[ 0 ];
+        gama2[ i ] = gama2[ 0 ];
+
+        for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+        {
+            prim1[ iEqu ][ i ] = prim1[ iEqu ][ 0 ];
+            prim2[ iEqu ][ i ] = prim2[ iEqu ][ 0 ];
+        }
+    }
+}
+
+inline Real BatchFMSplit2( Real mach, Real ipn )
+{
+    return ipn * fourth * SQR( mach + ipn );
+}
+
+inline Real BatchFPSplit5( Real mach, Real alpha, Real ipn )
+{
+    Real macha = ABS( mach );
+    Real super = half * ( one + ipn * mach / ( macha + SMALL ) );
+    Real sub   = BatchFMSplit2( mach, ipn ) * ( ( two * ipn - mach ) - ipn * sixteen * alpha * mach * BatchFMSplit2( mach,-ipn ) );
+    return ( macha >= one ) ? super : sub;
+}
+
+void RoeBatch( NsInvBatch & b )
+{
+    int  ieigenfix = ctrl.ieigenfix;
+    Real centropy1 = ctrl.centropy1;
+    Real centropy2 = ctrl.centropy2;
+
+#pragma omp simd
+    for ( int i = 0; i < NS_BATCH; ++ i )
+    {
+        Real rl = b.prim1[ IDX::IR ][ i ];
+        Real ul = b.prim1[ IDX::IU ][ i ];
+        Real vl = b.prim1[ IDX::IV ][ i ];
+        Real wl = b.prim1[ IDX::IW ][ i ];
+        Real pl = b.prim1[ IDX::IP ][ i ];
+
+        Real rr = b.prim2[ IDX::IR ][ i ];
+        Real ur = b.prim2[ IDX::IU ][ i ];
+        Real vr = b.prim2[ IDX::IV ][ i ];
+        Real wr = b.prim2[ IDX::IW ][ i ];
+        Real pr = b.prim2[ IDX::IP ][ i ];
+
+        Real gama1 = b.gama1[ i ];
+        Real gama2 = b.gama2[ i ];
+
+        Real xfn = b.xfn[ i ];
+        Real yfn = b.yfn[ i ];
+        Real zfn = b.zfn[ i ];
+        Real vfn = b.vfn[ i ];
+
+        Real v2l = SQR( ul, vl, wl );
+        Real v2r = SQR( ur, vr, wr );
+
+        Real hint_l = ( gama1 / ( gama1 - one ) ) * ( pl / rl );
+        Real hint_r = ( gama2 / ( gama2 - one ) ) * ( pr / rr );
+
+        Real hl = hint_l + half * v2l;
+        Real hr = hint_r + half * v2r;
+
+        Real vnl = xfn * ul + yfn * vl + zfn * wl - vfn;
+        Real vnr = xfn * ur + yfn * vr + zfn * wr - vfn;
+
+        Real rvnl = rl * vnl;
+        Real rvnr = rr * vnr;
+
+        Real ratio = sqrt( rr / rl );
+        Real coef  = 1.0 / ( 1.0 + ratio );
+
+        Real um   = ( ul + ur * ratio ) * coef;
+        Real vm   = ( vl + vr * ratio ) * coef;
+        Real wm   = ( wl + wr * ratio ) * coef;
+        Real hm   = ( hl + hr * ratio ) * coef;
+        Real gama = ( gama1 + gama2 * ratio ) * coef;
+
+        Real v2 = SQR( um, vm, wm );
+
+        Real vnflow = xfn * um + yfn * vm + zfn * wm;
+        Real vnrel  = vnflow - vfn;
+
+        Real gamm1 = gama - one;
+
+        Real c2 = gamm1 * ( hm - half * v2 );
+        Real cm = sqrt( ABS( c2 ) );
+
+        Real aeig1 = ABS( vnrel      );
+        Real aeig2 = ABS( vnrel + cm );
+        Real aeig3 = ABS( vnrel - cm );
+
+        Real flux[ NS_BATCH_NEQU ];
+        flux[ IDX::IR  ] = rvnl                   + rvnr                  ;
+        flux[ IDX::IRU ] = ( rvnl * ul + xfn * pl ) + ( rvnr * ur + xfn * pr );
+        flux[ IDX::IRV ] = ( rvnl * vl + yfn * pl ) + ( rvnr * vr + yfn * pr );
+        flux[ IDX::IRW ] = ( rvnl * wl + zfn * pl ) + ( rvnr * wr + zfn * pr );
+        flux[ IDX::IRE ] = ( rvnl * hl + vfn * pl ) + ( rvnr * hr + vfn * pr );
+
+        Real el = ( pl / rl ) / ( gama1 - one ) + half * SQR( ul, vl, wl );
+        Real er = ( pr / rr ) / ( gama2 - one ) + half * SQR( ur, vr, wr );
+
+        Real dq[ NS_BATCH_NEQU ];
+        dq[ IDX::IR  ] = rr      - rl;
+        dq[ IDX::IRU ] = rr * ur - rl * ul;
+        dq[ IDX::IRV ] = rr * vr - rl * vl;
+        dq[ IDX::IRW ] = rr * wr - rl * wl;
+        dq[ IDX::IRE ] = rr * er - rl * el;
+
+        //Entropy fix
+        Real meig1 = aeig1;
+        Real meig2 = aeig2;
+        Real meig3 = aeig3;
+
+        if ( ieigenfix == 1 )
+        {
+            Real maxEigenvalue = MAX( aeig2, aeig3 );
+            Real m1 = maxEigenvalue * centropy1;
+            Real m2 = maxEigenvalue * centropy2;
+
+            meig1 = MAX( m1, aeig1 );
+            meig2 = MAX( m2, aeig2 );
+            meig3 = MAX( m2, aeig3 );
+        }
+
+        Real xi1 = ( two * meig1 - meig2 - meig3 ) / ( two * c2 );
+        Real xi2 = ( meig2 - meig3 ) / ( two * cm );
+
+        Real dc   = vnflow * dq[ IDX::IR  ] -
+                    xfn    * dq[ IDX::IRU ] -
+                    yfn    * dq[ IDX::IRV ] -
+                    zfn    * dq[ IDX::IRW ];
+        Real c2dc = c2 * dc;
+
+        Real ae = gama - one;
+        Real af = half * ae * SQR( um, vm, wm );
+        Real dh = - ae * ( um * dq[ IDX::IRU ] + vm * dq[ IDX::IRV ] + wm * dq[ IDX::IRW ] - dq[ IDX::IRE ] );
+        dh += af * dq[ IDX::IR ];
+
+        Real term1 = dh   * xi1 + dc * xi2;
+        Real term2 = c2dc * xi1 + dh * xi2;
+
+        flux[ IDX::IR  ] -= ( meig1 * dq[ IDX::IR  ] -      term1                  );
+        flux[ IDX::IRU ] -= ( meig1 * dq[ IDX::IRU ] - um * term1 + xfn    * term2 );
+        flux[ IDX::IRV ] -= ( meig1 * dq[ IDX::IRV ] - vm * term1 + yfn    * term2 );
+        flux[ IDX::IRW ] -= ( meig1 * dq[ IDX::IRW ] - wm * term1 + zfn    * term2 );
+        flux[ IDX::IRE ] -= ( meig1 * dq[ IDX::IRE ] - hm * term1 + vnflow * term2 );
+
+        for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+        {
+            b.flux[ iEqu ][ i ] = flux[ iEqu ] * half;
+        }
+    }
+}
+
+void Slau2Batch( NsInvBatch & b )
+{
+#pragma omp simd
+    for ( int i = 0; i < NS_BATCH; ++ i )
+    {
+        Real rl = b.prim1[ IDX::IR ][ i ];
+        Real ul = b.prim1[ IDX::IU ][ i ];
+        Real vl = b.prim1[ IDX::IV ][ i ];
+        Real wl = b.prim1[ IDX::IW ][ i ];
+        Real pl = b.prim1[ IDX::IP ][ i ];
+
+        Real rr = b.prim2[ IDX::IR ][ i ];
+        Real ur = b.prim2[ IDX::IU ][ i ];
+        Real vr = b.prim2[ IDX::IV ][ i ];
+        Real wr = b.prim2[ IDX::IW ][ i ];
+        Real pr = b.prim2[ IDX::IP ][ i ];
+
+        Real gama1 = b.gama1[ i ];
+        Real gama2 = b.gama2[ i ];
+
+        Real xfn = b.xfn[ i ];
+        Real yfn = b.yfn[ i ];
+        Real zfn = b.zfn[ i ];
+        Real vfn = b.vfn[ i ];
+
+        Real v2l = SQR( ul, vl, wl );
+        Real v2r = SQR( ur, vr, wr );
+
+        Real hint_l = ( gama1 / ( gama1 - one ) ) * ( pl / rl );
+        Real hint_r = ( gama2 / ( gama2 - one ) ) * ( pr / rr );
+
+        Real hl = hint_l + half * v2l;
+        Real hr = hint_r + half * v2r;
+
+        Real vnl = xfn * ul + yfn * vl + zfn * wl - vfn;
+        Real vnr = xfn * ur + yfn * vr + zfn * wr - vfn;
+
+        Real orl = 1.0 / ( rl + SMALL );
+        Real orr = 1.0 / ( rr + SMALL );
+
+        Real c2l = gama1 * pl * orl;
+        Real c2r = gama2 * pr * orr;
+
+        Real cl = sqrt( c2l );
+        Real cr = sqrt( c2r );
+
+        Real cm = half * ( cl + cr );
+
+        Real t = rr / rl;
+        Real vna = ( ABS( vnl ) + t * ABS( vnr ) ) / ( 1 + t );
+
+        Real ml = vnl / cm;
+        Real mr = vnr / cm;
+
+        Real g = - MAX( MIN( ml, 0.0), -1.0 ) * MIN( MAX( mr, 0.0), 1.0 );
+
+        Real vnp = ( 1 - g ) * vna + g * ABS( vnl );
+        Real vnn = ( 1 - g ) * vna + g * ABS( vnr );
+
+        Real va = sqrt( half * ( v2l + v2r ) );
+        Real m12 = MIN( 1.0, va / cm );
+        Real ka = SQR( 1 - m12 );
+
+        Real ms = half * ( rl * ( vnl + vnp ) + rr * ( vnr - vnn ) - ka * ( pr - pl ) / cm );
+
+        Real fp5ml = BatchFPSplit5( ml, zero,  one );
+        Real fp5mr = BatchFPSplit5( mr, zero, -one );
+
+        Real ps = 0;
+        ps += half * ( pl + pr );
+        ps += half * ( fp5ml - fp5mr ) * ( pl - pr );
+        ps += va *( fp5ml + fp5mr - 1 ) * sqrt( rl * rr ) * cm;
+
+        Real mp = half * ( ms + ABS( ms ) );
+        Real mn = half * ( ms - ABS( ms ) );
+
+        b.flux[ IDX::IR  ][ i ] = ( mp      + mn      );
+        b.flux[ IDX::IRU ][ i ] = ( mp * ul + mn * ur ) + xfn * ps;
+        b.flux[ IDX::IRV ][ i ] = ( mp * vl + mn * vr ) + yfn * ps;
+        b.flux[ IDX::IRW ][ i ] = ( mp * wl + mn * wr ) + zfn * ps;
+        b.flux[ IDX::IRE ][ i ] = ( mp * hl + mn * hr ) + vfn * ps;
+    }
+}
+
+InvFluxBatchPointer GetInvFluxBatch( int schemeId )
+{
+    if ( ctrl.simdflux == 0 ) return 0;
+    if ( nscom.nEqu != NS_BATCH_NEQU || nscom.chemModel != 0 ) return 0;
+
+    if ( schemeId == ISCHEME_ROE )
+    {
+        return & RoeBatch;
+    }
+    else if ( schemeId == ISCHEME_SLAU2 )
+    {
+        return & Slau2Batch;
+    }
+
+    return 0;
+}
+
+EndNameSpace
@@ -25,6 +25,7 @@ License
 #include "NsIdx.h"
 #include "HXMath.h"
 #include "Parallel.h"
+#include "Com.h"
 #include <iostream>
 
 
@@ -58,6 +59,9 @@ void LusgsData::Init()
     drhs.resize( nEqu );
     rhs.resize( nEqu );
     tmp.resize( nEqu );
+
+    q1.resize( nEqu );
+    q2.resize( nEqu );
 }
 
 NsLusgs::NsLusgs()
@@ -81,7 +85,7 @@ void NsLusgs::DumpSweepInformation()
     }
 }
 
-void NsLusgs::ZeroFluxIncrement()
+void NsLusgs::ZeroFluxIncrement( LusgsData & nslu )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
@@ -89,7 +93,7 @@ void NsLusgs::ZeroFluxIncrement()
     }
 }
 
-void NsLusgs::AddViscousTerm()
+void NsLusgs::AddViscousTerm( LusgsData & nslu )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
@@ -97,7 +101,7 @@ void NsLusgs::AddViscousTerm()
     }
 }
 
-void NsLusgs::AddFluxIncrement()
+void NsLusgs::AddFluxIncrement( LusgsData & nslu )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
@@ -105,7 +109,7 @@ void NsLusgs::AddFluxIncrement()
     }
 }
 
-void NsLusgs::AddFluxIncrement( const Real & coef )
+void NsLusgs::AddFluxIncrement( LusgsData & nslu, const Real & coef )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
@@ -113,13 +117,16 @@ void NsLusgs::AddFluxIncrement( const Real & coef )
     }
 }
 
-void NsLusgs::GetFluxIncrement( int signOfMatrix )
+void NsLusgs::GetFluxIncrement( LusgsData & nslu, int signOfMatrix )
 {
-    this->GetStandardFluxIncrement( signOfMatrix );
+    this->CalcFaceEigenValue( nslu, nslu.primF );
+    this->GetStandardFluxIncrement( nslu, signOfMatrix );
 }
 
-void NsLusgs::CalcFaceEigenValue( RealField & prim )
+void NsLusgs::CalcFaceEigenValue( LusgsData & nslu, RealField & prim )
 {
+    GCom & gcom = nslu.gcom;
+
     //The value entered here should be the value on the action unit interface
     Real & rm  = prim[ IDX::IR ];
     Real & um  = prim[ IDX::IU ];
@@ -144,10 +151,11 @@ void NsLusgs::CalcFaceEigenValue( RealField & prim )
     nslu.lmdOnFace3 = max_eigen;
 }
 
-void NsLusgs::GetStandardFluxIncrement( int signOfMatrix )
+void NsLusgs::GetStandardFluxIncrement( LusgsData & nslu, int signOfMatrix )
 {
-    this->CalcFaceEigenValue( nslu.primF );
+    GCom & gcom = nslu.gcom;
 
+    //nslu.lmdOnFace1,2,3 are given by CalcFaceEigenValue or by the cached operator
     Real & rm  = nslu.primj[ IDX::IR ];
     Real & um  = nslu.primj[ IDX::IU ];
     Real & vm  = nslu.primj[ IDX::IV ];
@@ -227,7 +235,7 @@ bool NsLusgs::UpdateSweep( int iSweep )
     return false;
 }
 
-void NsLusgs::CalcLowerChange()
+void NsLusgs::CalcLowerChange( LusgsData & nslu )
 {
     if ( nslu.numberOfSweeps > 1 )
     {
@@ -276,7 +284,7 @@ void NsLusgs::CalcLowerChange()
     }
 }
 
-void NsLusgs::CalcUpperChange()
+void NsLusgs::CalcUpperChange( LusgsData & nslu )
 {
     if ( nslu.numberOfSweeps > 1 )
     {
@@ -326,12 +334,12 @@ void NsLusgs::CalcUpperChange()
 }
 
 
-bool NsLusgs::IsOversetCell()
+bool NsLusgs::IsOversetCell( LusgsData & nslu )
 {
-    return ( gcom.blank <= 0 );
+    return ( nslu.gcom.blank <= 0 );
 }
 
-void NsLusgs::ZeroOversetCell()
+void NsLusgs::ZeroOversetCell( LusgsData & nslu )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
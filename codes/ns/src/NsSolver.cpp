@@ -70,6 +70,9 @@ void NsSolver::StaticInit()
 
     solverInfo->implicitString.push_back( "q"  );
     solverInfo->implicitString.push_back( "dq" );
+
+    //the LU-SGS sweeps read and write all equations of one cell at a time
+    solverInfo->fieldLayout[ "dq" ] = FIELD_AOS;
 }
 
 EndNameSpace
@@ -22,6 +22,7 @@ License
 
 #include "NsSolverImp.h"
 #include "SolverImp.h"
+#include "InterField.h"
 #include "UTimeStep.h"
 #include "Zone.h"
 #include "UnsGrid.h"
@@ -115,10 +116,30 @@ void NsImplicitMethod( StringField & data )
     ;
 }
 
+bool NsOverlapInterfaceData()
+{
+    if ( ! ONEFLOW::OverlapInterfaceData() ) return false;
+
+    if ( ! Iteration::InnerOk() ) return true;
+
+    //visualization and restart files read the ghost cells, these iterations exchange as before
+    if ( Iteration::outerSteps % Iteration::nVisualSave == 0 ) return false;
+    if ( Iteration::outerSteps % Iteration::nFieldSave  == 0 ) return false;
+
+    return true;
+}
+
 void NsPostprocess( StringField & data )
 {
     //After every Iter, the first thing to consider is communication.
-    CommInterfaceData();
+    if ( ONEFLOW::NsOverlapInterfaceData() )
+    {
+        StartInterfaceData();
+    }
+    else
+    {
+        CommInterfaceData();
+    }
 
     //The solution and output of residuals need to be judged logically.
     if ( Iteration::ResOk() )
@@ -165,6 +186,8 @@ void DumpHeatFluxCoeff( StringField & data )
 
 void NsFinalPostprocess( StringField & data )
 {
+    ONEFLOW::FinishInterfaceData();
+
     ONEFLOW::AddCmdToList( "DUMP_RESTART"        );
     ONEFLOW::AddCmdToList( "DUMP_AERODYNAMIC"    );
     ONEFLOW::AddCmdToList( "DUMP_PRESSURE_COEFF" );
@@ -22,7 +22,7 @@ License
 
 #include "NsUpdate.h"
 #include "UNsUpdate.h"
-#include "NsInvFlux.h"
+#include "NsInvFluxImp.h"
 #include "NsCom.h"
 #include "NsIdx.h"
 #include "HXMath.h"
@@ -47,7 +47,24 @@ NsVis::~NsVis()
 
 void NsVis::Init()
 {
-    fvis.resize( nscom.nEqu );
+    fvis.resize( nscom.nTEqu );
+}
+
+NsVisFace::NsVisFace()
+{
+    ;
+}
+
+NsVisFace::~NsVisFace()
+{
+    ;
+}
+
+void NsVisFace::Init()
+{
+    vis.Init();
+    visQ.Init( nscom.nTEqu );
+    visT.Init( nscom.nTModel );
 }
 
 NsVisFlux::NsVisFlux()
@@ -60,78 +77,78 @@ NsVisFlux::~NsVisFlux()
     ;
 }
 
-void NsVisFlux::AverGrad()
+void NsVisFlux::AverGrad( NsVisFace & face )
 {
-    visQ.AverGrad();
-    visT.AverGrad();
+    face.visQ.AverGrad();
+    face.visT.AverGrad();
 }
 
-void NsVisFlux::ZeroNormalGrad()
+void NsVisFlux::ZeroNormalGrad( NsVisFace & face )
 {
-    visQ.ZeroNormalGrad();
-    visT.ZeroNormalGrad();
+    face.visQ.ZeroNormalGrad();
+    face.visT.ZeroNormalGrad();
 }
 
-void NsVisFlux::AverFaceValue()
+void NsVisFlux::AverFaceValue( NsVisFace & face )
 {
-    visQ.AverFaceValue();
-    visT.AverFaceValue();
-    this->AverOtherFaceValue();
+    face.visQ.AverFaceValue();
+    face.visT.AverFaceValue();
+    this->AverOtherFaceValue( face );
 }
 
-void NsVisFlux::AverOtherFaceValue()
+void NsVisFlux::AverOtherFaceValue( NsVisFace & face )
 {
-    nscom.visl   = half * ( nscom.visl1 + nscom.visl2 );
-    nscom.vist   = half * ( nscom.vist1 + nscom.vist2 );
+    face.visl   = half * ( face.visl1 + face.visl2 );
+    face.vist   = half * ( face.vist1 + face.vist2 );
 }
 
-void NsVisFlux::AccurateFaceValue()
+void NsVisFlux::AccurateFaceValue( NsVisFace & face )
 {
-    this->AccurateOtherFaceValue();
-    visQ.AccurateFaceValue();
-    visT.AccurateFaceValue();
+    this->AccurateOtherFaceValue( face );
+    face.visQ.AccurateFaceValue();
+    face.visT.AccurateFaceValue();
 }
 
-void NsVisFlux::AccurateOtherFaceValue()
+void NsVisFlux::AccurateOtherFaceValue( NsVisFace & face )
 {
-    nscom.visl   = half * ( nscom.visl1 + nscom.visl2 );
-    nscom.vist   = half * ( nscom.vist1 + nscom.vist2 );
+    face.visl   = half * ( face.visl1 + face.visl2 );
+    face.vist   = half * ( face.vist1 + face.vist2 );
 }
 
-void NsVisFlux::CorrectFaceGrad()
+void NsVisFlux::CorrectFaceGrad( NsVisFace & face )
 {
-    visQ.CorrectFaceGrad();
-    visT.CorrectFaceGrad();
+    face.visQ.CorrectFaceGrad( face.vgg );
+    face.visT.CorrectFaceGrad( face.vgg );
 }
 
-void NsVisFlux::CalcNormalGrad()
+void NsVisFlux::CalcNormalGrad( NsVisFace & face )
 {
-    visQ.CalcNormalGrad();
-    visT.CalcNormalGrad();
+    face.visQ.CalcNormalGrad( face.gcom );
+    face.visT.CalcNormalGrad( face.gcom );
 }
 
-void NsVisFlux::CalcTestMethod()
+void NsVisFlux::CalcTestMethod( NsVisFace & face )
 {
-    visQ.CalcTestMethod();
-    visT.CalcTestMethod();
+    face.visQ.CalcTestMethod( face.vgg, face.fId );
+    face.visT.CalcTestMethod( face.vgg, face.fId );
 }
 
-void NsVisFlux::CalcNew1Method()
+void NsVisFlux::CalcNew1Method( NsVisFace & face )
 {
-    visQ.CalcNew1Method();
-    visT.CalcNew1Method();
+    face.visQ.CalcNew1Method( face.vgg );
+    face.visT.CalcNew1Method( face.vgg );
 }
 
-void NsVisFlux::CalcNew2Method()
+void NsVisFlux::CalcNew2Method( NsVisFace & face )
 {
-    visQ.CalcNew2Method();
-    visT.CalcNew2Method();
+    face.visQ.CalcNew2Method( face.vgg );
+    face.visT.CalcNew2Method( face.vgg );
 }
 
-void NsVisFlux::ModifyFaceGrad()
+void NsVisFlux::ModifyFaceGrad( NsVisFace & face )
 {
-    visQ.ModifyFaceGrad();
-    visT.ModifyFaceGrad();
+    face.visQ.ModifyFaceGrad( face.vgg, face.gcom );
+    face.visT.ModifyFaceGrad( face.vgg, face.gcom );
 }
 
 EndNameSpace
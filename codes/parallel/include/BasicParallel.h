@@ -27,6 +27,7 @@ License
 #endif
 
 #include "Configure.h"
+#include "HXTypeBasic.h"
 #include <string>
 #include <vector>
 
@@ -37,6 +38,7 @@ BeginNameSpace( ONEFLOW )
     typedef  MPI_Request  PL_HXRequest;
     typedef  MPI_Op       PL_Op;
     typedef  MPI_Datatype PL_Datatype;
+    typedef  MPI_File     PL_File;
 
     #define PL_REQUEST_NULL    MPI_REQUEST_NULL
     #define PL_MAX             MPI_MAX
@@ -49,6 +51,7 @@ BeginNameSpace( ONEFLOW )
     typedef  int  PL_HXRequest;
     typedef  int  PL_Op;
     typedef  int  PL_Datatype;
+    typedef  int  PL_File;
 
     #define PL_REQUEST_NULL    0
     #define PL_MAX             0
@@ -65,6 +68,7 @@ void HXFinalize();
 
 int HXRank();
 int HXSize();
+void HXBarrier();
 
 std::string HXGetProcessorName();
 
@@ -74,6 +78,9 @@ void HXRecv( void * data, int size, PL_Datatype dataType, int pid, int tag = 0 )
 void HXSendChar( void * data, int size, int pid, int tag = 0 );
 void HXRecvChar( void * data, int size, int pid, int tag = 0 );
 
+void HXISend( void * data, int size, PL_Datatype dataType, int pid, PL_HXRequest * request, int tag = 0 );
+void HXIRecv( void * data, int size, PL_Datatype dataType, int pid, PL_HXRequest * request, int tag = 0 );
+
 int HXWait( PL_HXRequest * request );
 int HXWait( int count, PL_HXRequest * arrayOfRequests );
 
@@ -97,6 +104,13 @@ void HXSmartRecv( T * field, int nElement, int pid, int tag )
 
 void HXReduceInt( void * s, void * t, int nElem, PL_Op op );
 void HXReduceReal( void * s, void * t, int nElem, PL_Op op );
+void HXReduceLongLong( void * s, void * t, int nElem, PL_Op op );
+
+//Shared file access: open and close are collective, every process reads or writes its own ranges
+void HXFileOpen( PL_File * file, const std::string & fileName, bool writeFlag );
+void HXFileClose( PL_File * file );
+void HXFileWriteAt( PL_File * file, HXLongLong_t offset, void * data, HXLongLong_t size );
+void HXFileReadAt( PL_File * file, HXLongLong_t offset, void * data, HXLongLong_t size );
 
 
 EndNameSpace
@@ -121,4 +121,12 @@ class DataBook;
 
 void HXSwapData( DataBook * dataBook, int spid, int rpid, int tag = 0 );
 
+//Non-blocking counterparts of DataBook::Send/Recv, the length of the book travels separately
+void HXISendData( DataBook * dataBook, int rpid, std::vector< PL_HXRequest > & requests, int tag = 0 );
+void HXIRecvData( DataBook * dataBook, HXLongLong_t nLength, int spid, std::vector< PL_HXRequest > & requests, int tag = 0 );
+
+//Shared file counterparts of DataBook::WriteFile/ReadFile, the record starts at offset with its length
+void HXWriteDataAt( PL_File * file, HXLongLong_t offset, DataBook * dataBook );
+void HXReadDataAt( PL_File * file, HXLongLong_t offset, HXLongLong_t nLength, DataBook * dataBook );
+
 EndNameSpace
@@ -21,6 +21,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "BasicParallel.h"
+#include "Profiler.h"
 #include <iostream>
 
 
@@ -68,6 +69,13 @@ int HXSize()
     return size;
 }
 
+void HXBarrier()
+{
+#ifdef HX_PARALLEL
+    MPI_Barrier( MPI_COMM_WORLD );
+#endif
+}
+
 std::string HXGetProcessorName()
 {
     std::string procName = "";
@@ -94,6 +102,7 @@ void HXRecv( void * data, int size, PL_Datatype dataType, int pid, int tag )
 #ifdef HX_PARALLEL
     if ( size <= 0 ) return;
 
+    ProfileWaitScope waitScope;
     MPI_Status status;
     MPI_Recv( data, size, dataType, pid, tag, MPI_COMM_WORLD, & status );
 #endif
@@ -119,11 +128,30 @@ void HXRecvChar( void * data, int size, int pid, int tag )
 #endif
 }
 
+void HXISend( void * data, int size, PL_Datatype dataType, int pid, PL_HXRequest * request, int tag )
+{
+    * request = PL_REQUEST_NULL;
+#ifdef HX_PARALLEL
+    if ( size <= 0 ) return;
+    MPI_Isend( data, size, dataType, pid, tag, MPI_COMM_WORLD, request );
+#endif
+}
+
+void HXIRecv( void * data, int size, PL_Datatype dataType, int pid, PL_HXRequest * request, int tag )
+{
+    * request = PL_REQUEST_NULL;
+#ifdef HX_PARALLEL
+    if ( size <= 0 ) return;
+    MPI_Irecv( data, size, dataType, pid, tag, MPI_COMM_WORLD, request );
+#endif
+}
+
 int HXWait( PL_HXRequest * request )
 {
     int errorCode = 0;
 
 #ifdef HX_PARALLEL
+    ProfileWaitScope waitScope;
     errorCode = MPI_Wait( request, MPI_STATUS_IGNORE );
 #endif
 
@@ -137,6 +165,7 @@ int HXWait( int count, PL_HXRequest * arrayOfRequests )
     if ( count <= 0 ) return - 1;
 
 #ifdef HX_PARALLEL
+    ProfileWaitScope waitScope;
     errorCode = MPI_Waitall( count, arrayOfRequests, MPI_STATUSES_IGNORE );
 #endif
 
@@ -193,5 +222,52 @@ void HXReduceReal( void * s, void * t, int nElem, PL_Op op )
 
 }
 
+void HXReduceLongLong( void * s, void * t, int nElem, PL_Op op )
+{
+#ifdef HX_PARALLEL
+    MPI_Allreduce( s, t, nElem, MPI_LONG_LONG_INT, op, MPI_COMM_WORLD );
+#endif
+
+}
+
+void HXFileOpen( PL_File * file, const std::string & fileName, bool writeFlag )
+{
+#ifdef HX_PARALLEL
+    if ( writeFlag )
+    {
+        MPI_File_open( MPI_COMM_WORLD, const_cast< char * >( fileName.c_str() ), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, file );
+        //truncate an older and longer file, as std::ios_base::trunc does
+        MPI_File_set_size( * file, 0 );
+    }
+    else
+    {
+        MPI_File_open( MPI_COMM_WORLD, const_cast< char * >( fileName.c_str() ), MPI_MODE_RDONLY, MPI_INFO_NULL, file );
+    }
+#endif
+}
+
+void HXFileClose( PL_File * file )
+{
+#ifdef HX_PARALLEL
+    MPI_File_close( file );
+#endif
+}
+
+void HXFileWriteAt( PL_File * file, HXLongLong_t offset, void * data, HXLongLong_t size )
+{
+#ifdef HX_PARALLEL
+    if ( size <= 0 ) return;
+    MPI_File_write_at( * file, offset, data, size, MPI_CHAR, MPI_STATUS_IGNORE );
+#endif
+}
+
+void HXFileReadAt( PL_File * file, HXLongLong_t offset, void * data, HXLongLong_t size )
+{
+#ifdef HX_PARALLEL
+    if ( size <= 0 ) return;
+    MPI_File_read_at( * file, offset, data, size, MPI_CHAR, MPI_STATUS_IGNORE );
+#endif
+}
+
 
 EndNameSpace
@@ -213,6 +213,79 @@ void HXSwapData( DataBook * dataBook, int spid, int rpid, int tag )
     }
 }
 
+void HXISendData( DataBook * dataBook, int rpid, std::vector< PL_HXRequest > & requests, int tag )
+{
+    HXSize_t nPages = dataBook->dataBook->size();
+    for ( HXSize_t iPage = 0; iPage < nPages; ++ iPage )
+    {
+        DataPage * dataPage = dataBook->GetPage( iPage );
+        int nLength = dataPage->GetSize();
+        if ( nLength <= 0 ) continue;
+
+        requests.push_back( PL_REQUEST_NULL );
+        ONEFLOW::HXISend( dataPage->GetBeginDataPointer(), nLength, PL_CHAR, rpid, & requests.back(), tag );
+    }
+}
+
+void HXIRecvData( DataBook * dataBook, HXLongLong_t nLength, int spid, std::vector< PL_HXRequest > & requests, int tag )
+{
+    //the pages are cut exactly as on the sending side
+    dataBook->SecureAbsoluteSpace( nLength );
+
+    if ( nLength <= 0 ) return;
+
+    HXSize_t nPages = dataBook->dataBook->size();
+    for ( HXSize_t iPage = 0; iPage < nPages; ++ iPage )
+    {
+        DataPage * dataPage = dataBook->GetPage( iPage );
+        int nPageLength = dataPage->GetSize();
+        if ( nPageLength <= 0 ) continue;
+
+        requests.push_back( PL_REQUEST_NULL );
+        ONEFLOW::HXIRecv( dataPage->GetBeginDataPointer(), nPageLength, PL_CHAR, spid, & requests.back(), tag );
+    }
+}
+
+void HXWriteDataAt( PL_File * file, HXLongLong_t offset, DataBook * dataBook )
+{
+    HXLongLong_t nLength = dataBook->GetSize();
+
+    ONEFLOW::HXFileWriteAt( file, offset, & nLength, sizeof( HXLongLong_t ) );
+
+    HXLongLong_t pageOffset = offset + sizeof( HXLongLong_t );
+
+    HXSize_t nPages = dataBook->dataBook->size();
+    for ( HXSize_t iPage = 0; iPage < nPages; ++ iPage )
+    {
+        DataPage * dataPage = dataBook->GetPage( iPage );
+        HXLongLong_t nPageLength = dataPage->GetSize();
+        if ( nPageLength <= 0 ) continue;
+
+        ONEFLOW::HXFileWriteAt( file, pageOffset, dataPage->GetBeginDataPointer(), nPageLength );
+        pageOffset += nPageLength;
+    }
+}
+
+void HXReadDataAt( PL_File * file, HXLongLong_t offset, HXLongLong_t nLength, DataBook * dataBook )
+{
+    dataBook->SecureAbsoluteSpace( nLength );
+
+    if ( nLength <= 0 ) return;
+
+    HXLongLong_t pageOffset = offset + sizeof( HXLongLong_t );
+
+    HXSize_t nPages = dataBook->dataBook->size();
+    for ( HXSize_t iPage = 0; iPage < nPages; ++ iPage )
+    {
+        DataPage * dataPage = dataBook->GetPage( iPage );
+        HXLongLong_t nPageLength = dataPage->GetSize();
+        if ( nPageLength <= 0 ) continue;
+
+        ONEFLOW::HXFileReadAt( file, pageOffset, dataPage->GetBeginDataPointer(), nPageLength );
+        pageOffset += nPageLength;
+    }
+}
+
 void HXBcastString( std::string & cs, int pid )
 {
     int nlen = -1;
@@ -0,0 +1,38 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+
+
+BeginNameSpace( ONEFLOW )
+
+//order[ i ] is the old id of the new cell i
+//reverse Cuthill-McKee ordering of a cell graph given in compressed rows
+void CalcRcmOrder( int nCells, IntField & xadj, IntField & adjncy, IntField & order );
+int FindPeripheralCell( int root, IntField & xadj, IntField & adjncy, IntField & mark, int stamp );
+
+//ordering of the cells along the 3D Hilbert curve through their centers
+void CalcHilbertOrder( RealField & xc, RealField & yc, RealField & zc, IntField & order );
+HXLongLong_t CalcHilbertKey( unsigned int x, unsigned int y, unsigned int z );
+
+EndNameSpace
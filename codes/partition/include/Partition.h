@@ -25,6 +25,7 @@ License
 #include "HXDefine.h"
 #include "GridDef.h"
 #include "HXCgns.h"
+#include "CsrLink.h"
 #include <vector>
 #include <string>
 #include <fstream>
@@ -33,6 +34,10 @@ License
 #include "metis.h"
 #endif
 
+#ifdef ENABLE_PARMETIS
+#include "parmetis.h"
+#endif
+
 
 
 
@@ -54,32 +59,75 @@ public:
 public:
     G2LMapping * g2l;
 public:
-    void Alloc( UnsGrid * grid );
     void CalcL2G    ( UnsGrid * ggrid, int zid, UnsGrid * grid );
     void CalcL2GNode( UnsGrid * ggrid, int zid, UnsGrid * grid );
     void CalcL2GFace( UnsGrid * ggrid, int zid, UnsGrid * grid );
     void CalcL2GCell( UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void SortInnerFace( UnsGrid * ggrid, int nBFaces );
+    int GetLocalNode( int gnid );
 };
 
 class G2LMapping
 {
 public:
-    G2LMapping( UnsGrid * ggrid );
+    G2LMapping();
     ~G2LMapping();
 public:
-    IntField g2l_node;
-    IntField g2l_face;
     IntField g2l_cell;
     std::vector<idx_t> gc2lzone;
+    //global cells and faces of every zone, in ascending global order
+    CsrLink zoneCells;
+    CsrLink zoneFaces;
     UnsGrid * ggrid;
     int npartproc;
     LinkField c2c;
 public:
+    //0: uniform, 1: cost model, 2: per-cell weights read from partition_weight_file
+    int partition_weight;
+    //cost model: 1 balances the work, 2 the work and the memory; the weight file may give any number
+    int ncon;
+    int wall_layer;
+    Real wall_cost;
+    std::string weight_file;
+    //0: keep the global order, 1: reverse Cuthill-McKee, 2: Hilbert curve
+    int partition_order;
+    int nthreads;
+    //ncon weights per cell and one weight per adjncy entry, empty when uniform
+    std::vector<idx_t> vwgt;
+    std::vector<idx_t> adjwgt;
+    //the slab of cells [ vtxdist[ pid ], vtxdist[ pid + 1 ] ) of this process and their parts
+    std::vector<idx_t> vtxdist;
+    std::vector<idx_t> lpart;
+public:
+    void SetGrid( UnsGrid * ggrid );
     void GenerateGC2Z();
+    void CalcGraphWeight( std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy );
+    void CalcWallBand( std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy, IntField & band );
+    void CalcCellFaces( IntField & nCellFaces );
+    void CalcCostWeight( IntField & nCellFaces, IntField & band );
+    void ReadCellWeight( idx_t c0, idx_t nc );
+    void CalcEdgeWeight( std::vector<idx_t>& xadj, IntField & band, IntField & adjBand );
 #ifdef ENABLE_METIS
     void GetXadjAdjncy( UnsGrid * ggrid, std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy );
     void PartByMetis( idx_t nCells, std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy );
 #endif
+#ifdef ENABLE_PARMETIS
+    void PartGraphSlab( const std::string & fileName );
+    void ReadGraphSlab( const std::string & fileName, std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & nCellFaces, IntField & wall );
+    void CalcSlabWeight( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & nCellFaces, IntField & wall );
+    void CalcSlabWallBand( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & wall, IntField & band );
+    void PartByParMetis( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy );
+    void GatherPart( int gpid );
+    int GetSlabPid( idx_t cid );
+    void ExchangeSlab( std::vector< std::vector<idx_t> > & sendData, std::vector< std::vector<idx_t> > & recvData );
+#endif
+    void CalcZoneCells();
+    void CalcZoneFaces();
+    void ReorderZoneCells();
+    void ReorderZoneCells( int zid );
+    void CalcZoneGraph( int zid, IntField & xadj, IntField & adjncy );
+    void CalcZoneCellCenter( int zid, RealField & xc, RealField & yc, RealField & zc );
+    void FreeZoneList();
     void DumpXadjAdjncy( UnsGrid * grid, IntField & xadj, IntField & adjncy );
     void DumpGC2Z( UnsGrid * grid );
     void ReadGC2Z( UnsGrid * grid );
@@ -97,8 +145,9 @@ public:
     int npartproc;
     int partition_type;
     int partition_c2n;
+    int nthreads;
+    std::string ori_uns_file;
     G2LMapping * g2l;
-    L2GMapping * l2g;
 public:
     void Run();
     void ReadGrid();
@@ -112,15 +161,11 @@ public:
 public:
     void CalcGC2N();
     void CalcG2lCell();
-    void CalcG2lFace( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void CalcG2lNode( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    int GetNCell( UnsGrid * ggrid, int zid );
-    void CreateL2g( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void SetCoor( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void SetGeometricRelationship( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void CalcF2N( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void SetF2CAndBC( UnsGrid * ggrid, int zid, UnsGrid * grid );
-    void SetInterface( UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void SetCoor( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void SetGeometricRelationship( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void CalcF2N( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void SetF2CAndBC( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid );
+    void SetInterface( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid );
 };
 
 class FacePairBasic
@@ -0,0 +1,207 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "CellOrder.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+BeginNameSpace( ONEFLOW )
+
+void CalcRcmOrder( int nCells, IntField & xadj, IntField & adjncy, IntField & order )
+{
+    IntField degree( nCells );
+    std::vector< std::pair< int, int > > byDegree( nCells );
+    for ( int cid = 0; cid < nCells; ++ cid )
+    {
+        degree[ cid ] = xadj[ cid + 1 ] - xadj[ cid ];
+        byDegree[ cid ] = std::make_pair( degree[ cid ], cid );
+    }
+    std::sort( byDegree.begin(), byDegree.end() );
+
+    IntField visited( nCells, 0 );
+    IntField mark( nCells, 0 );
+
+    order.resize( 0 );
+    order.reserve( nCells );
+
+    std::vector< std::pair< int, int > > neighbors;
+
+    //one breadth first sweep per connected component, started from its lowest degree cell
+    for ( int i = 0; i < nCells; ++ i )
+    {
+        int root = byDegree[ i ].second;
+        if ( visited[ root ] ) continue;
+
+        root = ONEFLOW::FindPeripheralCell( root, xadj, adjncy, mark, i + 1 );
+
+        visited[ root ] = 1;
+        HXSize_t head = order.size();
+        order.push_back( root );
+
+        while ( head < order.size() )
+        {
+            int cid = order[ head ++ ];
+
+            neighbors.resize( 0 );
+            for ( int j = xadj[ cid ]; j < xadj[ cid + 1 ]; ++ j )
+            {
+                int nid = adjncy[ j ];
+                if ( visited[ nid ] ) continue;
+                visited[ nid ] = 1;
+                neighbors.push_back( std::make_pair( degree[ nid ], nid ) );
+            }
+
+            std::sort( neighbors.begin(), neighbors.end() );
+
+            for ( HXSize_t k = 0; k < neighbors.size(); ++ k )
+            {
+                order.push_back( neighbors[ k ].second );
+            }
+        }
+    }
+
+    std::reverse( order.begin(), order.end() );
+}
+
+//the last cell reached by a breadth first sweep from root, a cheap pseudo-peripheral start
+int FindPeripheralCell( int root, IntField & xadj, IntField & adjncy, IntField & mark, int stamp )
+{
+    IntField front;
+    IntField next;
+
+    mark[ root ] = stamp;
+    front.push_back( root );
+
+    int last = root;
+    while ( ! front.empty() )
+    {
+        next.resize( 0 );
+        for ( HXSize_t i = 0; i < front.size(); ++ i )
+        {
+            int cid = front[ i ];
+            for ( int j = xadj[ cid ]; j < xadj[ cid + 1 ]; ++ j )
+            {
+                int nid = adjncy[ j ];
+                if ( mark[ nid ] == stamp ) continue;
+                mark[ nid ] = stamp;
+                next.push_back( nid );
+            }
+        }
+        if ( ! next.empty() ) last = next[ next.size() - 1 ];
+        front.swap( next );
+    }
+
+    return last;
+}
+
+void CalcHilbertOrder( RealField & xc, RealField & yc, RealField & zc, IntField & order )
+{
+    int nCells = xc.size();
+
+    order.resize( nCells );
+    if ( nCells == 0 ) return;
+
+    Real xmin = * std::min_element( xc.begin(), xc.end() );
+    Real ymin = * std::min_element( yc.begin(), yc.end() );
+    Real zmin = * std::min_element( zc.begin(), zc.end() );
+    Real xmax = * std::max_element( xc.begin(), xc.end() );
+    Real ymax = * std::max_element( yc.begin(), yc.end() );
+    Real zmax = * std::max_element( zc.begin(), zc.end() );
+
+    //the same scale on every axis keeps the curve isotropic
+    Real len = std::max( xmax - xmin, std::max( ymax - ymin, zmax - zmin ) );
+    const unsigned int nMax = ( 1u << 21 ) - 1;
+    Real scale = ( len > 0.0 ) ? nMax / len : 0.0;
+
+    std::vector< std::pair< HXLongLong_t, int > > keys( nCells );
+    for ( int cid = 0; cid < nCells; ++ cid )
+    {
+        unsigned int ix = static_cast< unsigned int >( ( xc[ cid ] - xmin ) * scale );
+        unsigned int iy = static_cast< unsigned int >( ( yc[ cid ] - ymin ) * scale );
+        unsigned int iz = static_cast< unsigned int >( ( zc[ cid ] - zmin ) * scale );
+        keys[ cid ] = std::make_pair( ONEFLOW::CalcHilbertKey( ix, iy, iz ), cid );
+    }
+
+    std::sort( keys.begin(), keys.end() );
+
+    for ( int i = 0; i < nCells; ++ i )
+    {
+        order[ i ] = keys[ i ].second;
+    }
+}
+
+//Skilling's transpose form of the Hilbert index with 21 bits per axis, interleaved into 63 bits
+HXLongLong_t CalcHilbertKey( unsigned int x, unsigned int y, unsigned int z )
+{
+    const int nBits = 21;
+    unsigned int X[ 3 ] = { x, y, z };
+    unsigned int M = 1u << ( nBits - 1 );
+
+    for ( unsigned int Q = M; Q > 1; Q >>= 1 )
+    {
+        unsigned int P = Q - 1;
+        for ( int i = 0; i < 3; ++ i )
+        {
+            if ( X[ i ] & Q )
+            {
+                X[ 0 ] ^= P;
+            }
+            else
+            {
+                unsigned int t = ( X[ 0 ] ^ X[ i ] ) & P;
+                X[ 0 ] ^= t;
+                X[ i ] ^= t;
+            }
+        }
+    }
+
+    for ( int i = 1; i < 3; ++ i )
+    {
+        X[ i ] ^= X[ i - 1 ];
+    }
+
+    unsigned int t = 0;
+    for ( unsigned int Q = M; Q > 1; Q >>= 1 )
+    {
+        if ( X[ 2 ] & Q ) t ^= Q - 1;
+    }
+
+    for ( int i = 0; i < 3; ++ i )
+    {
+        X[ i ] ^= t;
+    }
+
+    HXLongLong_t key = 0;
+    for ( int j = nBits - 1; j >= 0; -- j )
+    {
+        for ( int i = 0; i < 3; ++ i )
+        {
+            key = ( key << 1 ) | ( ( X[ i ] >> j ) & 1 );
+        }
+    }
+
+    return key;
+}
+
+EndNameSpace
@@ -28,6 +28,7 @@ License
 #include "HXMath.h"
 #include "Stop.h"
 #include "BcRecord.h"
+#include "Boundary.h"
 #include "FaceTopo.h"
 #include "CellTopo.h"
 #include "CellMesh.h"
@@ -36,8 +37,13 @@ License
 #include "NodeMesh.h"
 #include "InterFace.h"
 #include "CalcGrid.h"
+#include "CellOrder.h"
 #include "DataBase.h"
+#include "Parallel.h"
+#include "Prj.h"
+#include <algorithm>
 #include <iostream>
+#include <cstring>
 
 
 BeginNameSpace( ONEFLOW )
@@ -54,149 +60,1002 @@ L2GMapping::~L2GMapping()
 
 void L2GMapping::CalcL2G( UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
-    this->Alloc( grid );
-    this->CalcL2GNode( ggrid, zid, grid );
-    this->CalcL2GFace( ggrid, zid, grid );
     this->CalcL2GCell( ggrid, zid, grid );
+    this->CalcL2GFace( ggrid, zid, grid );
+    this->CalcL2GNode( ggrid, zid, grid );
 }
 
-void L2GMapping::Alloc( UnsGrid * grid )
+void L2GMapping::CalcL2GNode( UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
-    int nNodes = grid->nNodes;
-    int nFaces = grid->nFaces;
-    int nCells = grid->nCells;
+    CsrLink & f2n = ggrid->faceTopo->faces;
+
+    int nFaces = this->l2g_face.size();
+
+    this->l2g_node.resize( 0 );
+    for ( int fid = 0; fid < nFaces; ++ fid )
+    {
+        CsrRow faceNode = f2n[ this->l2g_face[ fid ] ];
+        this->l2g_node.insert( this->l2g_node.end(), faceNode.begin(), faceNode.end() );
+    }
+
+    //local nodes keep the ascending global order
+    std::sort( this->l2g_node.begin(), this->l2g_node.end() );
+    this->l2g_node.erase( std::unique( this->l2g_node.begin(), this->l2g_node.end() ), this->l2g_node.end() );
+
+    grid->nNodes = this->l2g_node.size();
+}
+
+void L2GMapping::CalcL2GFace( UnsGrid * ggrid, int zid, UnsGrid * grid )
+{
+    int nGBFaces = ggrid->nBFaces;
+
+    IntField & glCell = ggrid->faceTopo->lCells;
+    IntField & grCell = ggrid->faceTopo->rCells;
+
+    CsrRow faces = g2l->zoneFaces[ zid ];
+    int nZoneFaces = faces.size();
+
+    this->l2g_face.resize( 0 );
+    this->l2g_face.reserve( nZoneFaces );
+
+    //physical boundary
+    int iFace = 0;
+    while ( iFace < nZoneFaces && faces[ iFace ] < nGBFaces )
+    {
+        this->l2g_face.push_back( faces[ iFace ] );
+        ++ iFace;
+    }
+    int nPBFaces = iFace;
+
+    //interface
+    for ( int i = nPBFaces; i < nZoneFaces; ++ i )
+    {
+        int gfid = faces[ i ];
+        if ( g2l->gc2lzone[ glCell[ gfid ] ] != g2l->gc2lzone[ grCell[ gfid ] ] )
+        {
+            this->l2g_face.push_back( gfid );
+        }
+    }
+    int nBFaces = this->l2g_face.size();
+
+    //inner face
+    for ( int i = nPBFaces; i < nZoneFaces; ++ i )
+    {
+        int gfid = faces[ i ];
+        if ( g2l->gc2lzone[ glCell[ gfid ] ] == g2l->gc2lzone[ grCell[ gfid ] ] )
+        {
+            this->l2g_face.push_back( gfid );
+        }
+    }
+
+    if ( g2l->partition_order != 0 )
+    {
+        this->SortInnerFace( ggrid, nBFaces );
+    }
+
+    int nIFaces = nBFaces - nPBFaces;
+
+    grid->nFaces  = nZoneFaces;
+    grid->nBFaces = nBFaces;
+
+    InterFace * interFace = grid->interFace;
+    interFace->Set( nIFaces );
+    grid->nIFaces = nIFaces;
+}
+
+void L2GMapping::CalcL2GCell( UnsGrid * ggrid, int zid, UnsGrid * grid )
+{
+    CsrRow cells = g2l->zoneCells[ zid ];
+    this->l2g_cell.assign( cells.begin(), cells.end() );
+
+    grid->nCells = this->l2g_cell.size();
+}
+
+//inner faces follow the local cells, sorted by ( lc, rc )
+void L2GMapping::SortInnerFace( UnsGrid * ggrid, int nBFaces )
+{
+    IntField & glCell = ggrid->faceTopo->lCells;
+    IntField & grCell = ggrid->faceTopo->rCells;
+
+    HXLongLong_t nCells = this->l2g_cell.size();
+    int nFaces = this->l2g_face.size();
+
+    std::vector< std::pair< HXLongLong_t, int > > keys;
+    keys.reserve( nFaces - nBFaces );
+    for ( int fid = nBFaces; fid < nFaces; ++ fid )
+    {
+        int gfid = this->l2g_face[ fid ];
+        HXLongLong_t lc = g2l->g2l_cell[ glCell[ gfid ] ];
+        HXLongLong_t rc = g2l->g2l_cell[ grCell[ gfid ] ];
+        keys.push_back( std::make_pair( lc * nCells + rc, gfid ) );
+    }
+
+    std::sort( keys.begin(), keys.end() );
+
+    for ( int fid = nBFaces; fid < nFaces; ++ fid )
+    {
+        this->l2g_face[ fid ] = keys[ fid - nBFaces ].second;
+    }
+}
+
+int L2GMapping::GetLocalNode( int gnid )
+{
+    return std::lower_bound( this->l2g_node.begin(), this->l2g_node.end(), gnid ) - this->l2g_node.begin();
+}
+
+G2LMapping::G2LMapping()
+{
+    this->ggrid = 0;
+    this->npartproc = GetDataValue< int >( "npartproc" );
+    this->partition_weight = GetDataValueOrDefault< int >( "partition_weight", 0 );
+    this->ncon = GetDataValueOrDefault< int >( "partition_ncon", 1 );
+    this->wall_layer = GetDataValueOrDefault< int >( "partition_wall_layer", 10 );
+    this->wall_cost = GetDataValueOrDefault< Real >( "partition_wall_cost", 2.0 );
+    this->weight_file = GetDataValueOrDefault< std::string >( "partition_weight_file", "" );
+    this->partition_order = GetDataValueOrDefault< int >( "partition_order", 0 );
+    this->nthreads = MAX( GetDataValueOrDefault< int >( "nthreads", 1 ), 1 );
+
+    //without weights the only constraint is the number of cells
+    if ( partition_weight == 0 )
+    {
+        this->ncon = 1;
+    }
+    else if ( partition_weight == 1 && ( ncon < 1 || ncon > 2 ) )
+    {
+        Stop( "partition_ncon must be 1 (work) or 2 (work and memory) for partition_weight = 1!\n" );
+    }
+    else if ( ncon < 1 )
+    {
+        Stop( "partition_ncon must be at least 1!\n" );
+    }
+
+    if ( npartproc < 2 )
+    {
+        Stop( "The number of partitions should be greater than 1!\n" );
+    }
+}
+
+G2LMapping::~G2LMapping()
+{
+}
+
+//only the process holding the global grid keeps the mappings
+void G2LMapping::SetGrid( UnsGrid * ggrid )
+{
+    this->ggrid = ggrid;
+
+    if ( ggrid )
+    {
+        this->g2l_cell.resize( ggrid->nCells );
+        this->gc2lzone.resize( ggrid->nCells );
+    }
+}
+
+void G2LMapping::GenerateGC2Z()
+{
+#ifdef ENABLE_PARMETIS
+    if ( Parallel::nProc > 1 )
+    {
+        //the graph was partitioned in slabs by PartGraphSlab before the grid was read,
+        //the grid holder is the process of the only zone in the original grid
+        int gpid = ZoneState::pid[ 0 ];
+        this->GatherPart( gpid );
+        return;
+    }
+#endif
+
+    if ( ! ggrid ) return;
+
+    idx_t nCells = ggrid->nCells;
+    int nFaces  = ggrid->nFaces;
+    int nBFaces = ggrid->nBFaces;
+
+    std::vector<idx_t> xadj( nCells + 1 );
+    std::vector<idx_t> adjncy( 2 * ( nFaces - nBFaces ) );
+
+    this->GetXadjAdjncy( ggrid, xadj, adjncy );
+    this->CalcGraphWeight( xadj, adjncy );
+
+    this->PartByMetis( nCells, xadj, adjncy );
+    //this->DumpGC2Z( gridForPartition );
+    //this->ReadGC2Z( gridForPartition );
+}
+
+void G2LMapping::CalcGraphWeight( std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy )
+{
+    if ( partition_weight == 0 ) return;
+
+    IntField band;
+    this->CalcWallBand( xadj, adjncy, band );
+
+    if ( partition_weight == 1 )
+    {
+        IntField nCellFaces;
+        this->CalcCellFaces( nCellFaces );
+        this->CalcCostWeight( nCellFaces, band );
+    }
+    else
+    {
+        this->ReadCellWeight( 0, ggrid->nCells );
+    }
+
+    IntField adjBand( adjncy.size() );
+    for ( HXSize_t j = 0; j < adjncy.size(); ++ j )
+    {
+        adjBand[ j ] = band[ adjncy[ j ] ];
+    }
+
+    this->CalcEdgeWeight( xadj, band, adjBand );
+}
+
+//band[ i ] = 1 for the cells within wall_layer layers from a solid wall
+void G2LMapping::CalcWallBand( std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy, IntField & band )
+{
+    int nCells  = ggrid->nCells;
+    int nBFaces = ggrid->nBFaces;
+
+    IntField & lCells = ggrid->faceTopo->lCells;
+    IntField & bcType = ggrid->faceTopo->bcManager->bcRecord->bcType;
+
+    band.resize( nCells );
+    band = 0;
+
+    IntField front;
+    for ( int fid = 0; fid < nBFaces; ++ fid )
+    {
+        if ( ! BC::IsWallBc( bcType[ fid ] ) ) continue;
+        int lc = lCells[ fid ];
+        if ( band[ lc ] ) continue;
+        band[ lc ] = 1;
+        front.push_back( lc );
+    }
+
+    IntField next;
+    for ( int iLayer = 1; iLayer < wall_layer && ! front.empty(); ++ iLayer )
+    {
+        next.resize( 0 );
+        for ( HXSize_t i = 0; i < front.size(); ++ i )
+        {
+            int cid = front[ i ];
+            for ( idx_t j = xadj[ cid ]; j < xadj[ cid + 1 ]; ++ j )
+            {
+                int nid = adjncy[ j ];
+                if ( band[ nid ] ) continue;
+                band[ nid ] = 1;
+                next.push_back( nid );
+            }
+        }
+        front.swap( next );
+    }
+}
+
+void G2LMapping::CalcCellFaces( IntField & nCellFaces )
+{
+    int nCells = ggrid->nCells;
+    int nFaces = ggrid->nFaces;
+
+    IntField & lCells = ggrid->faceTopo->lCells;
+    IntField & rCells = ggrid->faceTopo->rCells;
+
+    nCellFaces.resize( nCells );
+    nCellFaces = 0;
+    for ( int fid = 0; fid < nFaces; ++ fid )
+    {
+        ++ nCellFaces[ lCells[ fid ] ];
+        int rc = rCells[ fid ];
+        if ( rc >= 0 && rc < nCells ) ++ nCellFaces[ rc ];
+    }
+}
+
+//work: faces of the cell, scaled by wall_cost in the wall band; memory: faces of the cell
+void G2LMapping::CalcCostWeight( IntField & nCellFaces, IntField & band )
+{
+    int nCells = nCellFaces.size();
+
+    vwgt.resize( ncon * nCells );
+    for ( int cid = 0; cid < nCells; ++ cid )
+    {
+        Real cost = band[ cid ] ? wall_cost : 1.0;
+        vwgt[ ncon * cid ] = MAX< idx_t >( static_cast< idx_t >( nCellFaces[ cid ] * cost + 0.5 ), 1 );
+        if ( ncon > 1 )
+        {
+            vwgt[ ncon * cid + 1 ] = nCellFaces[ cid ];
+        }
+    }
+}
+
+//ascii file of ncon integers per cell in global cell order, e.g. the cell costs timed in a previous run;
+//the weights of the cells [ c0, c0 + nc ) are kept
+void G2LMapping::ReadCellWeight( idx_t c0, idx_t nc )
+{
+    std::fstream file;
+    file.open( weight_file.c_str(), std::ios_base::in );
+    if ( ! file )
+    {
+        Stop( "can not open partition_weight_file " + weight_file + "\n" );
+    }
+
+    idx_t skip = 0;
+    for ( idx_t i = 0; i < ncon * c0; ++ i )
+    {
+        if ( ! ( file >> skip ) )
+        {
+            Stop( "partition_weight_file " + weight_file + " has fewer than ncon * nCells weights\n" );
+        }
+    }
+
+    vwgt.resize( ncon * nc );
+    for ( idx_t i = 0; i < ncon * nc; ++ i )
+    {
+        if ( ! ( file >> vwgt[ i ] ) )
+        {
+            Stop( "partition_weight_file " + weight_file + " has fewer than ncon * nCells weights\n" );
+        }
+        vwgt[ i ] = MAX< idx_t >( vwgt[ i ], 1 );
+    }
+
+    file.close();
+}
+
+//cutting through the thin cells of the wall band costs wall_cost times more communication;
+//adjBand[ j ] is the band flag of the neighbor adjncy[ j ]
+void G2LMapping::CalcEdgeWeight( std::vector<idx_t>& xadj, IntField & band, IntField & adjBand )
+{
+    int nCells = band.size();
+
+    idx_t wallWeight = MAX< idx_t >( static_cast< idx_t >( wall_cost + 0.5 ), 1 );
 
-    this->l2g_node.resize( nNodes );
-    this->l2g_face.resize( nFaces );
-    this->l2g_cell.resize( nCells );
+    adjwgt.resize( adjBand.size() );
+    for ( int cid = 0; cid < nCells; ++ cid )
+    {
+        for ( idx_t j = xadj[ cid ]; j < xadj[ cid + 1 ]; ++ j )
+        {
+            adjwgt[ j ] = ( band[ cid ] && adjBand[ j ] ) ? wallWeight : 1;
+        }
+    }
+}
+#ifdef ENABLE_METIS
+void G2LMapping::GetXadjAdjncy( UnsGrid * ggrid, std::vector<idx_t> & xadj, std::vector<idx_t>& adjncy )
+{   
+    int  nCells = ggrid->nCells;
+    CalcC2C( ggrid );
+    LinkField & c2c = ggrid->cellMesh->cellTopo->c2c;
+    xadj[ 0 ]  = 0;
+    int iCount = 0;
+    for ( int iCell = 0; iCell < nCells; ++ iCell )
+    {
+        xadj[ iCell + 1 ] = xadj[ iCell ] + c2c[ iCell ].size();
+        for ( HXSize_t j = 0; j < c2c[ iCell ].size(); ++ j )
+        {
+            adjncy[ iCount ++ ] = c2c[ iCell ][ j ];
+        }
+    }
+}
+
+void G2LMapping::PartByMetis( idx_t nCells, std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy )
+{
+    idx_t   ncon     = this->ncon;
+    idx_t   * vwgt   = this->vwgt.empty() ? 0 : & this->vwgt[ 0 ];
+    idx_t   * vsize  = 0;
+    idx_t   * adjwgt = this->adjwgt.empty() ? 0 : & this->adjwgt[ 0 ];
+    float * tpwgts = 0;
+    float * ubvec  = 0;
+    idx_t options[ METIS_NOPTIONS ];
+    idx_t wgtflag = 0;
+    idx_t numflag = 0;
+    idx_t objval;
+    idx_t nZone = npartproc;
+
+    METIS_SetDefaultOptions( options );
+    std::cout << "Now begining partition graph!\n";
+    if ( nZone > 8 )
+    {
+        std::cout << "Using K-way Partitioning!\n";
+        METIS_PartGraphKway( & nCells, & ncon, & xadj[ 0 ], & adjncy[ 0 ], vwgt, vsize, adjwgt, 
+                             & nZone, tpwgts, ubvec, options, & objval, & gc2lzone[ 0 ] );
+    }
+    else
+    {
+        std::cout << "Using Recursive Partitioning!\n";
+        METIS_PartGraphRecursive( & nCells, & ncon, & xadj[ 0 ], & adjncy[ 0 ], vwgt, vsize, adjwgt, 
+                                  & nZone, tpwgts, ubvec, options, & objval, & gc2lzone[ 0 ] );
+    }
+    std::cout << "The interface number: " << objval << std::endl; 
+    std::cout << "Partition is finished!\n";
+}
+#endif
+
+#ifdef ENABLE_PARMETIS
+//every process reads the face records of its own slab of faces, so no process holds the global graph
+void G2LMapping::PartGraphSlab( const std::string & fileName )
+{
+    std::vector<idx_t> lxadj;
+    std::vector<idx_t> ladjncy;
+    IntField nCellFaces;
+    IntField wall;
+
+    this->ReadGraphSlab( fileName, lxadj, ladjncy, nCellFaces, wall );
+
+    if ( partition_weight != 0 )
+    {
+        this->CalcSlabWeight( lxadj, ladjncy, nCellFaces, wall );
+    }
+
+    this->PartByParMetis( lxadj, ladjncy );
+}
+
+//the file holds nZones, the pid and the type of every zone, then the length and the record of each zone,
+//the record of a zone is written by UnsGrid::WriteGrid
+void G2LMapping::ReadGraphSlab( const std::string & fileName, std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & nCellFaces, IntField & wall )
+{
+    int nProc = Parallel::nProc;
+    int pid   = Parallel::pid;
+
+    PL_File file;
+    ONEFLOW::HXFileOpen( & file, Prj::prjBaseDir + fileName, false );
+
+    int nZones = 0;
+    ONEFLOW::HXFileReadAt( & file, 0, & nZones, sizeof( int ) );
+    if ( nZones > 1 )
+    {
+        Stop( "partition only splits an original grid with one zone, ori_uns_file has more than one!\n" );
+    }
+
+    HXLongLong_t offset = ( 1 + 2 * nZones ) * sizeof( int ) + sizeof( HXLongLong_t );
+
+    int nSize[ 3 ] = { 0, 0, 0 };
+    ONEFLOW::HXFileReadAt( & file, offset, nSize, 3 * sizeof( int ) );
+    int nNodes = nSize[ 0 ];
+    int nFaces = nSize[ 1 ];
+    int nCells = nSize[ 2 ];
+
+    //nNodes, nFaces, nCells, the coordinates and volBcType
+    offset += 3 * sizeof( int ) + 3 * static_cast< HXLongLong_t >( nNodes ) * sizeof( Real ) + sizeof( int );
+
+    int f0 = static_cast< int >( ( static_cast< HXLongLong_t >( nFaces ) * pid ) / nProc );
+    int f1 = static_cast< int >( ( static_cast< HXLongLong_t >( nFaces ) * ( pid + 1 ) ) / nProc );
+    int nf = f1 - f0;
+
+    //the node lists are skipped, their total length gives the offset of the cells of the faces
+    IntField numFaceNode( nf );
+    ONEFLOW::HXFileReadAt( & file, offset + f0 * sizeof( int ), numFaceNode.data(), nf * sizeof( int ) );
+    HXLongLong_t nFaceNode = 0;
+    for ( int i = 0; i < nf; ++ i )
+    {
+        nFaceNode += numFaceNode[ i ];
+    }
+    HXLongLong_t gnFaceNode = nFaceNode;
+    ONEFLOW::HXReduceLongLong( & nFaceNode, & gnFaceNode, 1, PL_SUM );
+    offset += ( nFaces + gnFaceNode ) * sizeof( int );
+
+    IntField lCells( nf );
+    IntField rCells( nf );
+    ONEFLOW::HXFileReadAt( & file, offset + f0 * sizeof( int ), lCells.data(), nf * sizeof( int ) );
+    offset += static_cast< HXLongLong_t >( nFaces ) * sizeof( int );
+    ONEFLOW::HXFileReadAt( & file, offset + f0 * sizeof( int ), rCells.data(), nf * sizeof( int ) );
+    offset += static_cast< HXLongLong_t >( nFaces ) * sizeof( int );
+
+    //the boundary faces come first
+    int nBFaces = 0;
+    ONEFLOW::HXFileReadAt( & file, offset, & nBFaces, sizeof( int ) );
+    offset += sizeof( int );
+
+    int nbf = MAX( MIN( f1, nBFaces ) - f0, 0 );
+    IntField bcType( nbf );
+    ONEFLOW::HXFileReadAt( & file, offset + f0 * sizeof( int ), bcType.data(), nbf * sizeof( int ) );
+
+    ONEFLOW::HXFileClose( & file );
+
+    vtxdist.resize( nProc + 1 );
+    for ( int ip = 0; ip <= nProc; ++ ip )
+    {
+        vtxdist[ ip ] = static_cast< idx_t >( ( static_cast< HXLongLong_t >( nCells ) * ip ) / nProc );
+    }
+
+    //one ( cell, neighbor, wall ) record per side of every face goes to the process of the cell,
+    //the neighbor is -1 for a boundary face
+    std::vector< std::vector<idx_t> > sendData( nProc );
+    std::vector< std::vector<idx_t> > recvData;
+    for ( int i = 0; i < nf; ++ i )
+    {
+        int lc = lCells[ i ];
+        int rc = rCells[ i ];
+        if ( lc < 0 ) ONEFLOW::SWAP( lc, rc );
+
+        if ( f0 + i < nBFaces )
+        {
+            std::vector<idx_t> & data = sendData[ this->GetSlabPid( lc ) ];
+            data.push_back( lc );
+            data.push_back( - 1 );
+            data.push_back( BC::IsWallBc( bcType[ i ] ) ? 1 : 0 );
+        }
+        else
+        {
+            std::vector<idx_t> & ldata = sendData[ this->GetSlabPid( lc ) ];
+            ldata.push_back( lc );
+            ldata.push_back( rc );
+            ldata.push_back( 0 );
+            std::vector<idx_t> & rdata = sendData[ this->GetSlabPid( rc ) ];
+            rdata.push_back( rc );
+            rdata.push_back( lc );
+            rdata.push_back( 0 );
+        }
+    }
+
+    this->ExchangeSlab( sendData, recvData );
+
+    idx_t c0 = vtxdist[ pid ];
+    idx_t nLocal = vtxdist[ pid + 1 ] - c0;
+
+    nCellFaces.resize( nLocal );
+    wall.resize( nLocal );
+    nCellFaces = 0;
+    wall = 0;
+    lxadj.resize( nLocal + 1 );
+    std::fill( lxadj.begin(), lxadj.end(), 0 );
+
+    for ( int ip = 0; ip < nProc; ++ ip )
+    {
+        std::vector<idx_t> & data = recvData[ ip ];
+        for ( HXSize_t i = 0; i < data.size(); i += 3 )
+        {
+            idx_t cid = data[ i ] - c0;
+            ++ nCellFaces[ cid ];
+            if ( data[ i + 2 ] ) wall[ cid ] = 1;
+            if ( data[ i + 1 ] >= 0 ) ++ lxadj[ cid + 1 ];
+        }
+    }
+
+    for ( idx_t cid = 0; cid < nLocal; ++ cid )
+    {
+        lxadj[ cid + 1 ] += lxadj[ cid ];
+    }
+
+    //neighbors keep the order of the faces
+    ladjncy.resize( lxadj[ nLocal ] );
+    std::vector<idx_t> pos( lxadj.begin(), lxadj.end() - 1 );
+    for ( int ip = 0; ip < nProc; ++ ip )
+    {
+        std::vector<idx_t> & data = recvData[ ip ];
+        for ( HXSize_t i = 0; i < data.size(); i += 3 )
+        {
+            if ( data[ i + 1 ] < 0 ) continue;
+            ladjncy[ pos[ data[ i ] - c0 ] ++ ] = data[ i + 1 ];
+        }
+    }
+}
+
+//the weights of CalcGraphWeight, with the wall band grown across the slabs
+void G2LMapping::CalcSlabWeight( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & nCellFaces, IntField & wall )
+{
+    int nProc = Parallel::nProc;
+    int pid   = Parallel::pid;
+    idx_t c0 = vtxdist[ pid ];
+    idx_t nLocal = vtxdist[ pid + 1 ] - c0;
+
+    IntField band;
+    this->CalcSlabWallBand( lxadj, ladjncy, wall, band );
+
+    if ( partition_weight == 1 )
+    {
+        this->CalcCostWeight( nCellFaces, band );
+    }
+    else
+    {
+        this->ReadCellWeight( c0, nLocal );
+    }
+
+    //the band flags of the neighbors in other slabs are asked from their processes
+    std::vector< std::vector<idx_t> > askData( nProc );
+    std::vector< std::vector<idx_t> > askedData;
+    for ( HXSize_t j = 0; j < ladjncy.size(); ++ j )
+    {
+        int ip = this->GetSlabPid( ladjncy[ j ] );
+        if ( ip != pid ) askData[ ip ].push_back( ladjncy[ j ] );
+    }
+
+    this->ExchangeSlab( askData, askedData );
+
+    std::vector< std::vector<idx_t> > replyData( nProc );
+    std::vector< std::vector<idx_t> > answerData;
+    for ( int ip = 0; ip < nProc; ++ ip )
+    {
+        for ( HXSize_t i = 0; i < askedData[ ip ].size(); ++ i )
+        {
+            replyData[ ip ].push_back( band[ askedData[ ip ][ i ] - c0 ] );
+        }
+    }
+
+    this->ExchangeSlab( replyData, answerData );
+
+    //the answers come back in the order of the questions
+    IntField adjBand( ladjncy.size() );
+    IntField answerPos( nProc, 0 );
+    for ( HXSize_t j = 0; j < ladjncy.size(); ++ j )
+    {
+        int ip = this->GetSlabPid( ladjncy[ j ] );
+        if ( ip == pid )
+        {
+            adjBand[ j ] = band[ ladjncy[ j ] - c0 ];
+        }
+        else
+        {
+            adjBand[ j ] = answerData[ ip ][ answerPos[ ip ] ++ ];
+        }
+    }
+
+    this->CalcEdgeWeight( lxadj, band, adjBand );
+}
+
+//CalcWallBand layer by layer, a layer that crosses a slab goes on in the process of the neighbor
+void G2LMapping::CalcSlabWallBand( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy, IntField & wall, IntField & band )
+{
+    int nProc = Parallel::nProc;
+    int pid   = Parallel::pid;
+    idx_t c0 = vtxdist[ pid ];
+    idx_t nLocal = vtxdist[ pid + 1 ] - c0;
+
+    band = wall;
+
+    IntField front;
+    for ( idx_t cid = 0; cid < nLocal; ++ cid )
+    {
+        if ( band[ cid ] ) front.push_back( cid );
+    }
+
+    IntField next;
+    for ( int iLayer = 1; iLayer < wall_layer; ++ iLayer )
+    {
+        int nFront = front.size();
+        int gnFront = nFront;
+        ONEFLOW::HXReduceInt( & nFront, & gnFront, 1, PL_SUM );
+        if ( gnFront == 0 ) break;
+
+        next.resize( 0 );
+        std::vector< std::vector<idx_t> > sendData( nProc );
+        std::vector< std::vector<idx_t> > recvData;
+        for ( HXSize_t i = 0; i < front.size(); ++ i )
+        {
+            int cid = front[ i ];
+            for ( idx_t j = lxadj[ cid ]; j < lxadj[ cid + 1 ]; ++ j )
+            {
+                idx_t gnid = ladjncy[ j ];
+                int ip = this->GetSlabPid( gnid );
+                if ( ip != pid )
+                {
+                    sendData[ ip ].push_back( gnid );
+                }
+                else if ( ! band[ gnid - c0 ] )
+                {
+                    band[ gnid - c0 ] = 1;
+                    next.push_back( gnid - c0 );
+                }
+            }
+        }
+
+        this->ExchangeSlab( sendData, recvData );
+
+        for ( int ip = 0; ip < nProc; ++ ip )
+        {
+            for ( HXSize_t i = 0; i < recvData[ ip ].size(); ++ i )
+            {
+                idx_t nid = recvData[ ip ][ i ] - c0;
+                if ( band[ nid ] ) continue;
+                band[ nid ] = 1;
+                next.push_back( nid );
+            }
+        }
+        front.swap( next );
+    }
+}
+
+void G2LMapping::PartByParMetis( std::vector<idx_t>& lxadj, std::vector<idx_t>& ladjncy )
+{
+    int nProc = Parallel::nProc;
+    int pid   = Parallel::pid;
+
+    idx_t nLocal = vtxdist[ pid + 1 ] - vtxdist[ pid ];
+    lpart.resize( nLocal + 1 );
+
+    idx_t   ncon     = this->ncon;
+    idx_t   * vwgt   = this->vwgt.empty() ? 0 : & this->vwgt[ 0 ];
+    idx_t   * adjwgt = this->adjwgt.empty() ? 0 : & this->adjwgt[ 0 ];
+    //both the vertex weights and the edge weights are given
+    idx_t wgtflag = ( partition_weight != 0 ) ? 3 : 0;
+    idx_t numflag = 0;
+    idx_t nZone = npartproc;
+    idx_t options[ 3 ] = { 0, 0, 0 };
+    idx_t edgecut = 0;
+    std::vector<real_t> tpwgts( ncon * nZone, 1.0 / nZone );
+    std::vector<real_t> ubvec( ncon, 1.05 );
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    if ( pid == 0 )
+    {
+        std::cout << "Now begining parallel partition graph on " << nProc << " processes!\n";
+    }
+
+    ParMETIS_V3_PartKway( & vtxdist[ 0 ], & lxadj[ 0 ], ladjncy.data(), vwgt, adjwgt, & wgtflag, & numflag,
+                          & ncon, & nZone, & tpwgts[ 0 ], & ubvec[ 0 ], options, & edgecut, & lpart[ 0 ], & comm );
+
+    if ( pid == 0 )
+    {
+        std::cout << "The interface number: " << edgecut << std::endl;
+        std::cout << "Partition is finished!\n";
+    }
+}
+
+void G2LMapping::GatherPart( int gpid )
+{
+    int nProc = Parallel::nProc;
+    int pid   = Parallel::pid;
+    int tag   = Parallel::GetDefaultTag();
+
+    if ( pid == gpid )
+    {
+        for ( int ip = 0; ip < nProc; ++ ip )
+        {
+            idx_t c0 = vtxdist[ ip ];
+            idx_t nc = vtxdist[ ip + 1 ] - c0;
+
+            if ( ip == gpid )
+            {
+                std::copy( lpart.begin(), lpart.begin() + nc, gc2lzone.begin() + c0 );
+                continue;
+            }
+
+            ONEFLOW::HXSmartRecv( gc2lzone.data() + c0, nc, ip, tag );
+        }
+    }
+    else
+    {
+        idx_t nLocal = vtxdist[ pid + 1 ] - vtxdist[ pid ];
+        ONEFLOW::HXSmartSend( & lpart[ 0 ], nLocal, gpid, tag );
+    }
+}
+
+int G2LMapping::GetSlabPid( idx_t cid )
+{
+    return static_cast< int >( std::upper_bound( vtxdist.begin(), vtxdist.end(), cid ) - vtxdist.begin() ) - 1;
 }
 
-void L2GMapping::CalcL2GNode( UnsGrid * ggrid, int zid, UnsGrid * grid )
+//sendData[ ip ] goes to process ip, recvData[ ip ] is what process ip sent to this one
+void G2LMapping::ExchangeSlab( std::vector< std::vector<idx_t> > & sendData, std::vector< std::vector<idx_t> > & recvData )
 {
-    int nNodes = ggrid->nNodes;
+    int nProc = Parallel::nProc;
 
-    for ( int iNode = 0; iNode < nNodes; ++ iNode )
+    std::vector<int> sendCount( nProc );
+    std::vector<int> recvCount( nProc );
+    for ( int ip = 0; ip < nProc; ++ ip )
     {
-        if ( g2l->g2l_node[ iNode ] > - 1 )
-        {
-            this->l2g_node[ g2l->g2l_node[ iNode ] ] = iNode;
-        }
+        sendCount[ ip ] = static_cast< int >( sendData[ ip ].size() * sizeof( idx_t ) );
     }
-}
 
-void L2GMapping::CalcL2GFace( UnsGrid * ggrid, int zid, UnsGrid * grid )
-{
-    int nFaces = ggrid->nFaces;
+    MPI_Alltoall( & sendCount[ 0 ], 1, MPI_INT, & recvCount[ 0 ], 1, MPI_INT, MPI_COMM_WORLD );
 
-    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    std::vector<int> sendDispl( nProc + 1, 0 );
+    std::vector<int> recvDispl( nProc + 1, 0 );
+    for ( int ip = 0; ip < nProc; ++ ip )
     {
-        int fid = g2l->g2l_face[ iFace ];
-        if ( fid >= 0 )
-        {
-            this->l2g_face[ fid ] = iFace;
-        }
+        sendDispl[ ip + 1 ] = sendDispl[ ip ] + sendCount[ ip ];
+        recvDispl[ ip + 1 ] = recvDispl[ ip ] + recvCount[ ip ];
+    }
+
+    std::vector<char> sendBuffer( sendDispl[ nProc ] + 1 );
+    std::vector<char> recvBuffer( recvDispl[ nProc ] + 1 );
+    for ( int ip = 0; ip < nProc; ++ ip )
+    {
+        if ( sendCount[ ip ] == 0 ) continue;
+        memcpy( & sendBuffer[ sendDispl[ ip ] ], & sendData[ ip ][ 0 ], sendCount[ ip ] );
+    }
+
+    MPI_Alltoallv( & sendBuffer[ 0 ], & sendCount[ 0 ], & sendDispl[ 0 ], MPI_CHAR,
+                   & recvBuffer[ 0 ], & recvCount[ 0 ], & recvDispl[ 0 ], MPI_CHAR, MPI_COMM_WORLD );
+
+    recvData.resize( nProc );
+    for ( int ip = 0; ip < nProc; ++ ip )
+    {
+        recvData[ ip ].resize( recvCount[ ip ] / sizeof( idx_t ) );
+        if ( recvCount[ ip ] == 0 ) continue;
+        memcpy( & recvData[ ip ][ 0 ], & recvBuffer[ recvDispl[ ip ] ], recvCount[ ip ] );
     }
 }
+#endif
 
-void L2GMapping::CalcL2GCell( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void G2LMapping::CalcZoneCells()
 {
     int nCells = ggrid->nCells;
-    int cid = 0;
-    for ( int gcid = 0; gcid < nCells; ++ gcid )
+
+    IntField rowSize( npartproc, 0 );
+    for ( int cid = 0; cid < nCells; ++ cid )
     {
-        if ( g2l->gc2lzone[ gcid ] == zid )
-        {
-            this->l2g_cell[ cid ] = gcid;
-            ++ cid;
-        }
+        ++ rowSize[ gc2lzone[ cid ] ];
+    }
+
+    zoneCells.Alloc( rowSize );
+
+    IntField pos = zoneCells.start;
+    for ( int cid = 0; cid < nCells; ++ cid )
+    {
+        zoneCells.data[ pos[ gc2lzone[ cid ] ] ++ ] = cid;
     }
 }
 
-G2LMapping::G2LMapping( UnsGrid * ggrid )
+void G2LMapping::CalcZoneFaces()
 {
-    this->ggrid = ggrid;
+    int nCells = ggrid->nCells;
+    int nFaces = ggrid->nFaces;
+
+    IntField & glCell = ggrid->faceTopo->lCells;
+    IntField & grCell = ggrid->faceTopo->rCells;
 
-    this->g2l_cell.resize( ggrid->nCells );
-    this->g2l_face.resize( ggrid->nFaces );
-    this->g2l_node.resize( ggrid->nNodes );
-    this->gc2lzone.resize( ggrid->nCells );
+    //a face belongs to the zone of its left cell and to the zone of its right cell
+    IntField rowSize( npartproc, 0 );
+    for ( int fid = 0; fid < nFaces; ++ fid )
+    {
+        int glc = glCell[ fid ];
+        int grc = grCell[ fid ];
+        int lz = gc2lzone[ glc ];
+        int rz = ( grc < nCells ) ? static_cast< int >( gc2lzone[ grc ] ) : lz;
+        ++ rowSize[ lz ];
+        if ( rz != lz ) ++ rowSize[ rz ];
+    }
 
-    this->npartproc = GetDataValue< int >( "npartproc" );
+    zoneFaces.Alloc( rowSize );
+
+    IntField pos = zoneFaces.start;
+    for ( int fid = 0; fid < nFaces; ++ fid )
+    {
+        int glc = glCell[ fid ];
+        int grc = grCell[ fid ];
+        int lz = gc2lzone[ glc ];
+        int rz = ( grc < nCells ) ? static_cast< int >( gc2lzone[ grc ] ) : lz;
+        zoneFaces.data[ pos[ lz ] ++ ] = fid;
+        if ( rz != lz ) zoneFaces.data[ pos[ rz ] ++ ] = fid;
+    }
 }
 
-G2LMapping::~G2LMapping()
+void G2LMapping::ReorderZoneCells()
 {
+    if ( partition_order == 0 ) return;
+
+    CalcC2C( ggrid );
+
+    //every zone only rewrites its own row and the g2l_cell of its own cells
+#pragma omp parallel for schedule( dynamic, 1 ) num_threads( nthreads )
+    for ( int zid = 0; zid < npartproc; ++ zid )
+    {
+        this->ReorderZoneCells( zid );
+    }
 }
 
-void G2LMapping::GenerateGC2Z()
+void G2LMapping::ReorderZoneCells( int zid )
 {
-    if ( npartproc < 2 )
+    CsrRow cells = zoneCells[ zid ];
+    int nZoneCells = cells.size();
+
+    IntField order;
+    if ( partition_order == 1 )
     {
-        Stop( "The number of partitions should be greater than 1!\n" );
+        IntField xadj;
+        IntField adjncy;
+        this->CalcZoneGraph( zid, xadj, adjncy );
+        ONEFLOW::CalcRcmOrder( nZoneCells, xadj, adjncy, order );
+    }
+    else
+    {
+        RealField xc;
+        RealField yc;
+        RealField zc;
+        this->CalcZoneCellCenter( zid, xc, yc, zc );
+        ONEFLOW::CalcHilbertOrder( xc, yc, zc, order );
     }
 
-    int nCells  = ggrid->nCells;
-    int nFaces  = ggrid->nFaces;
-    int nBFaces = ggrid->nBFaces;
-
-    std::vector<idx_t> xadj  ( ggrid->nCells + 1 );
-    std::vector<idx_t> adjncy( 2 * ( nFaces - nBFaces ) );
+    IntField oldCells;
+    oldCells.assign( cells.begin(), cells.end() );
 
-    this->GetXadjAdjncy( ggrid, xadj, adjncy );
-    this->PartByMetis( nCells, xadj, adjncy );
-    //this->DumpGC2Z( gridForPartition );
-    //this->ReadGC2Z( gridForPartition );
+    for ( int i = 0; i < nZoneCells; ++ i )
+    {
+        int gcid = oldCells[ order[ i ] ];
+        cells[ i ] = gcid;
+        g2l_cell[ gcid ] = i;
+    }
 }
-#ifdef ENABLE_METIS
-void G2LMapping::GetXadjAdjncy( UnsGrid * ggrid, std::vector<idx_t> & xadj, std::vector<idx_t>& adjncy )
-{   
-    int  nCells = ggrid->nCells;
-    CalcC2C( ggrid );
+
+//graph of the cells inside the zone, in the current local numbering
+void G2LMapping::CalcZoneGraph( int zid, IntField & xadj, IntField & adjncy )
+{
     LinkField & c2c = ggrid->cellMesh->cellTopo->c2c;
-    xadj[ 0 ]  = 0;
-    int iCount = 0;
-    for ( int iCell = 0; iCell < nCells; ++ iCell )
+    int nCells = ggrid->nCells;
+
+    CsrRow cells = zoneCells[ zid ];
+    int nZoneCells = cells.size();
+
+    xadj.resize( nZoneCells + 1 );
+    xadj[ 0 ] = 0;
+    adjncy.resize( 0 );
+    for ( int i = 0; i < nZoneCells; ++ i )
     {
-        xadj[ iCell + 1 ] = xadj[ iCell ] + c2c[ iCell ].size();
-        for ( HXSize_t j = 0; j < c2c[ iCell ].size(); ++ j )
+        IntField & neighbors = c2c[ cells[ i ] ];
+        for ( HXSize_t j = 0; j < neighbors.size(); ++ j )
         {
-            adjncy[ iCount ++ ] = c2c[ iCell ][ j ];
+            int gnid = neighbors[ j ];
+            if ( gnid >= nCells || gc2lzone[ gnid ] != zid ) continue;
+            adjncy.push_back( g2l_cell[ gnid ] );
         }
+        xadj[ i + 1 ] = adjncy.size();
     }
 }
 
-void G2LMapping::PartByMetis( idx_t nCells, std::vector<idx_t>& xadj, std::vector<idx_t>& adjncy )
+//the average of the face centers around a cell is close enough for the curve
+void G2LMapping::CalcZoneCellCenter( int zid, RealField & xc, RealField & yc, RealField & zc )
 {
-    idx_t   ncon     = 1;
-    idx_t   * vwgt   = 0;
-    idx_t   * vsize  = 0;
-    idx_t   * adjwgt = 0;
-    float * tpwgts = 0;
-    float * ubvec  = 0;
-    idx_t options[ METIS_NOPTIONS ];
-    idx_t wgtflag = 0;
-    idx_t numflag = 0;
-    idx_t objval;
-    idx_t nZone = npartproc;
+    int nCells = ggrid->nCells;
 
-    METIS_SetDefaultOptions( options );
-    std::cout << "Now begining partition graph!\n";
-    if ( nZone > 8 )
+    IntField & glCell = ggrid->faceTopo->lCells;
+    IntField & grCell = ggrid->faceTopo->rCells;
+    CsrLink & f2n = ggrid->faceTopo->faces;
+
+    RealField & xN = ggrid->nodeMesh->xN;
+    RealField & yN = ggrid->nodeMesh->yN;
+    RealField & zN = ggrid->nodeMesh->zN;
+
+    int nZoneCells = zoneCells.RowSize( zid );
+    xc.resize( nZoneCells );
+    yc.resize( nZoneCells );
+    zc.resize( nZoneCells );
+    xc = 0.0;
+    yc = 0.0;
+    zc = 0.0;
+    IntField count( nZoneCells, 0 );
+
+    CsrRow faces = zoneFaces[ zid ];
+    for ( int i = 0; i < faces.size(); ++ i )
     {
-        std::cout << "Using K-way Partitioning!\n";
-        METIS_PartGraphKway( & nCells, & ncon, & xadj[ 0 ], & adjncy[ 0 ], vwgt, vsize, adjwgt, 
-                             & nZone, tpwgts, ubvec, options, & objval, & gc2lzone[ 0 ] );
+        int gfid = faces[ i ];
+        CsrRow faceNode = f2n[ gfid ];
+        int nFNode = faceNode.size();
+
+        Real xf = 0.0;
+        Real yf = 0.0;
+        Real zf = 0.0;
+        for ( int iNode = 0; iNode < nFNode; ++ iNode )
+        {
+            xf += xN[ faceNode[ iNode ] ];
+            yf += yN[ faceNode[ iNode ] ];
+            zf += zN[ faceNode[ iNode ] ];
+        }
+        xf /= nFNode;
+        yf /= nFNode;
+        zf /= nFNode;
+
+        int side[ 2 ] = { glCell[ gfid ], grCell[ gfid ] };
+        for ( int k = 0; k < 2; ++ k )
+        {
+            int gcid = side[ k ];
+            if ( gcid < 0 || gcid >= nCells || gc2lzone[ gcid ] != zid ) continue;
+            int cid = g2l_cell[ gcid ];
+            xc[ cid ] += xf;
+            yc[ cid ] += yf;
+            zc[ cid ] += zf;
+            ++ count[ cid ];
+        }
     }
-    else
+
+    for ( int cid = 0; cid < nZoneCells; ++ cid )
     {
-        std::cout << "Using Recursive Partitioning!\n";
-        METIS_PartGraphRecursive( & nCells, & ncon, & xadj[ 0 ], & adjncy[ 0 ], vwgt, vsize, adjwgt, 
-                                  & nZone, tpwgts, ubvec, options, & objval, & gc2lzone[ 0 ] );
+        if ( count[ cid ] == 0 ) continue;
+        xc[ cid ] /= count[ cid ];
+        yc[ cid ] /= count[ cid ];
+        zc[ cid ] /= count[ cid ];
     }
-    std::cout << "The interface number: " << objval << std::endl; 
-    std::cout << "Partition is finished!\n";
 }
-#endif
+
+void G2LMapping::FreeZoneList()
+{
+    zoneCells.Clear();
+    zoneFaces.Clear();
+}
 
 void G2LMapping::DumpXadjAdjncy( UnsGrid * grid, IntField & xadj, IntField & adjncy )
 {
@@ -217,9 +1076,13 @@ void G2LMapping::ReadGC2Z( UnsGrid * grid )
 Partition::Partition()
 {
     g2l = 0;
+    uns_grid = 0;
     this->partition_type = GetDataValue< int >( "partition_type" );
     this->npartproc = GetDataValue< int >( "npartproc" );
     this->partition_c2n = GetDataValue< int >( "partition_c2n" );
+    //the grid tasks do not run Ctrl::Init, so the thread count is read here
+    this->nthreads = MAX( GetDataValueOrDefault< int >( "nthreads", 1 ), 1 );
+    this->ori_uns_file = GetDataValue< std::string >( "ori_uns_file" );
 }
 
 Partition::~Partition()
@@ -229,28 +1092,43 @@ Partition::~Partition()
 
 void Partition::Run()
 {
+    g2l = new G2LMapping();
+
+#ifdef ENABLE_PARMETIS
+    //the graph is read in slabs and partitioned before the whole grid is loaded
+    if ( Parallel::nProc > 1 )
+    {
+        g2l->PartGraphSlab( ori_uns_file );
+    }
+#endif
+
     this->ReadGrid();
 
     this->GenerateMultiZoneGrid();
 
+    //the other processes only take part in the graph partitioning
+    if ( ! uns_grid ) return;
+
     ONEFLOW::GenerateMultiZoneCalcGrids( grids );
 }
 
 void Partition::ReadGrid()
 {
     StringField gridFileList;
-    std::string ori_uns_file = GetDataValue< std::string >( "ori_uns_file" );
     gridFileList.push_back( ori_uns_file );
 
+    //the sub-grids are built from the whole original grid, which is read by the process of its zone
+    //and must fit in the memory of one node; only the graph partitioning is distributed
     Zone::ReadGrid( gridFileList );
 
     int nZones = ZoneState::nZones;
 
     if ( nZones > 1 )
     {
-        std::cout << " At present, there is no support for multiple blocks such as nZones > 1 !\n";
+        Stop( "partition only splits an original grid with one zone, ori_uns_file has more than one!\n" );
     }
-    else
+
+    if ( ZoneState::IsValidZone( 0 ) )
     {
         Grid * grid = Zone::GetGrid();
         uns_grid = UnsGridCast( grid );
@@ -261,6 +1139,8 @@ void Partition::GenerateMultiZoneGrid()
 {
     this->CreatePart();
 
+    if ( ! uns_grid ) return;
+
     this->AllocPart();
 
     this->BuildCalculationalGrid();
@@ -268,9 +1148,11 @@ void Partition::GenerateMultiZoneGrid()
 
 void Partition::CreatePart()
 {
-    g2l = new G2LMapping( uns_grid );
-    g2l->npartproc = this->npartproc;
+    g2l->SetGrid( uns_grid );
     g2l->GenerateGC2Z();
+
+    if ( ! uns_grid ) return;
+
     this->CalcG2lCell();
 
     if ( this->partition_c2n )
@@ -297,10 +1179,11 @@ void Partition::AllocPart()
 void Partition::BuildCalculationalGrid()
 {
     this->PreProcess();
+    //for unstructured grid, each processor only contains one zone, so pid equal to zid
+    //every zone only reads the global grid, so the zones are built concurrently
+#pragma omp parallel for schedule( dynamic, 1 ) num_threads( nthreads )
     for ( int pid = 0; pid < npartproc; ++ pid )
     {
-        std::cout << "BuildCalculationalGrid pid = " << pid << " npartproc = " << npartproc << "\n";
-        //for unstructured grid, each processor only contains one zone, so pid equal to zid
         this->BuildCalculationalGrid( pid );
     }
     this->PostProcess();
@@ -308,10 +1191,14 @@ void Partition::BuildCalculationalGrid()
 
 void Partition::PreProcess()
 {
+    g2l->CalcZoneCells();
+    g2l->CalcZoneFaces();
+    g2l->ReorderZoneCells();
 }
 
 void Partition::PostProcess()
 {
+    g2l->FreeZoneList();
 }
 
 void Partition::CalcGC2N()
@@ -334,10 +1221,9 @@ void Partition::BuildCalculationalGrid( int zid )
 {
     UnsGrid * grid = UnsGridCast( grids[ zid ] );
 
-    grid->nCells = this->GetNCell( uns_grid, zid );
-
-    this->CalcG2lFace( uns_grid, zid, grid );
-    this->CalcG2lNode( uns_grid, zid, grid );
+    L2GMapping * l2g = new L2GMapping();
+    l2g->g2l = this->g2l;
+    l2g->CalcL2G( uns_grid, zid, grid );
 
     if ( partition_c2n )
     {
@@ -345,204 +1231,59 @@ void Partition::BuildCalculationalGrid( int zid )
     //    this->WriteCellToNode( grid );
     }
 
-    this->l2g = new L2GMapping();
-    this->CreateL2g( uns_grid, zid, grid );
-    this->SetCoor  ( uns_grid, zid, grid );
-    this->SetGeometricRelationship( uns_grid, zid, grid );
-    delete this->l2g;
-}
-
-void Partition::CalcG2lFace( UnsGrid * ggrid, int zid, UnsGrid * grid )
-{
-    int nCells  = ggrid->nCells;
-    int nFaces  = ggrid->nFaces;
-    int nBFaces = ggrid->nBFaces;
-
-    IntField & glCell = ggrid->faceTopo->lCells;
-    IntField & grCell = ggrid->faceTopo->rCells;
-
-    for ( int fid = 0; fid < nFaces; ++ fid )
-    {
-        g2l->g2l_face[ fid ] = - 2;
-    }
-
-    //set all face in iZone to -1
-    for ( int fid = 0; fid < nFaces; ++ fid )
-    {
-        int glc = glCell[ fid ];
-        int grc = grCell[ fid ];
-        if ( g2l->gc2lzone[ glc ] == zid )
-        {
-            g2l->g2l_face[ fid ] = - 1;
-        }
-        else if ( grc < nCells && g2l->gc2lzone[ grc ] == zid )
-        {
-            g2l->g2l_face[ fid ] = - 1;
-        }
-    }
-
-    int nFaceNow = 0;
-
-    //physical boundary
-    for ( int fid = 0; fid < nBFaces; ++ fid )
-    {
-        if ( g2l->g2l_face[ fid ] == - 1 )
-        {
-            g2l->g2l_face[ fid ] = nFaceNow ++;
-        }
-    }
-
-    int nIFaceNow = 0;
-    for ( int fid = nBFaces; fid < nFaces; ++ fid )
-    {
-        if ( g2l->g2l_face[ fid ] == - 1 )
-        {
-            int glc = glCell[ fid ];
-            int grc = grCell[ fid ];
-            if ( g2l->gc2lzone[ glc ] != g2l->gc2lzone[ grc ] )
-            {
-                g2l->g2l_face[ fid ] = nFaceNow ++;
-                nIFaceNow ++;
-            }
-        }
-    }
-
-    //inner boundary
-    int nBFaceNow = nFaceNow;
-    for ( int fid = nBFaces; fid < nFaces; ++ fid )
-    {
-        if ( g2l->g2l_face[ fid ] == - 1 )
-        {
-            int glc = glCell[ fid ];
-            int grc = grCell[ fid ];
-
-            if ( g2l->gc2lzone[ glc ] == g2l->gc2lzone[ grc ] )
-            {
-                g2l->g2l_face[ fid ] = nFaceNow ++;
-            }
-        }
-    }
-
-    grid->nFaces  = nFaceNow;
-    grid->nBFaces = nBFaceNow;
-
-    InterFace * interFace = grid->interFace;
-    interFace->Set( nIFaceNow );
-    grid->nIFaces = nIFaceNow;
-}
-
-void Partition::CalcG2lNode( UnsGrid * ggrid, int zid, UnsGrid * grid )
-{
-    int nFaces = ggrid->nFaces;
-    int nNodes = ggrid->nNodes;
-
-    LinkField & f2n = ggrid->faceTopo->faces;
-
-    for ( int iNode = 0; iNode < nNodes; ++ iNode )
-    {
-        g2l->g2l_node[ iNode ] = - 2;
-    }
-
-    //set iZone g2l->g2l_node to -1
-    int iCount = 0;
-    for ( int iFace = 0; iFace < nFaces; ++ iFace )
-    {
-        if ( g2l->g2l_face[ iFace ] > - 1 )
-        {
-            int nFNode = f2n[ iFace ].size();
-            for ( int iNode = 0; iNode < nFNode; ++ iNode )
-            {
-                g2l->g2l_node[ f2n[ iFace ][ iNode ] ] = - 1;
-            }
-        }
-    }
-
-    int nLNode = 0;
-    for ( int iNode = 0; iNode < nNodes; ++ iNode )
-    {
-        if ( g2l->g2l_node[ iNode ] == - 1 )
-        {
-            g2l->g2l_node[ iNode ] = nLNode ++;
-        }
-    }
-
-    grid->nNodes = nLNode;
-}
-
-int Partition::GetNCell( UnsGrid * ggrid, int zid )
-{
-    int nCells = ggrid->nCells;
-    int iCount = 0;
-    for ( int iCell = 0; iCell < nCells; ++ iCell )
-    {
-        if ( g2l->gc2lzone[ iCell ] == zid )
-        {
-            iCount ++;
-        }
-    }
-    return iCount;
-}
-
-void Partition::CreateL2g( UnsGrid * ggrid, int zid, UnsGrid * grid )
-{
-    l2g->g2l = this->g2l;
-    l2g->CalcL2G( ggrid, zid, grid );
+    this->SetCoor( l2g, uns_grid, zid, grid );
+    this->SetGeometricRelationship( l2g, uns_grid, zid, grid );
+    delete l2g;
 }
 
-void Partition::SetCoor( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void Partition::SetCoor( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
     int nNodes = grid->nNodes;
     grid->nodeMesh->CreateNodes( nNodes );
 
-    int iCount = 0;
-    for ( int iNode = 0; iNode < ggrid->nNodes; ++ iNode )
-    {
-        if ( g2l->g2l_node[ iNode ] > - 1 )
-        {
-            grid->nodeMesh->xN[ iCount ] = ggrid->nodeMesh->xN[ iNode ];
-            grid->nodeMesh->yN[ iCount ] = ggrid->nodeMesh->yN[ iNode ];
-            grid->nodeMesh->zN[ iCount ] = ggrid->nodeMesh->zN[ iNode ];
-            ++ iCount;
-        }
-    }
-
-    if ( iCount != nNodes )
+    for ( int iNode = 0; iNode < nNodes; ++ iNode )
     {
-        std::cout << "error in Partition::SetCoor\n";
+        int gnid = l2g->l2g_node[ iNode ];
+        grid->nodeMesh->xN[ iNode ] = ggrid->nodeMesh->xN[ gnid ];
+        grid->nodeMesh->yN[ iNode ] = ggrid->nodeMesh->yN[ gnid ];
+        grid->nodeMesh->zN[ iNode ] = ggrid->nodeMesh->zN[ gnid ];
     }
 }
 
-void Partition::SetGeometricRelationship( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void Partition::SetGeometricRelationship( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
-    this->CalcF2N( ggrid, zid, grid );
-    this->SetF2CAndBC( ggrid, zid, grid );
-    this->SetInterface( ggrid, zid, grid );
+    this->CalcF2N( l2g, ggrid, zid, grid );
+    this->SetF2CAndBC( l2g, ggrid, zid, grid );
+    this->SetInterface( l2g, ggrid, zid, grid );
 }
 
-void Partition::CalcF2N( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void Partition::CalcF2N( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
-    LinkField & f2n = grid->faceTopo->faces;
-    LinkField & gf2n = ggrid->faceTopo->faces;
+    CsrLink & f2n = grid->faceTopo->faces;
+    CsrLink & gf2n = ggrid->faceTopo->faces;
 
     int nFaces = grid->nFaces;
-    f2n.resize( nFaces );
 
+    IntField numFaceNode( nFaces );
     for ( int fid = 0; fid < nFaces; ++ fid )
     {
-        int gfid = l2g->l2g_face[ fid ];
+        numFaceNode[ fid ] = gf2n.RowSize( l2g->l2g_face[ fid ] );
+    }
+    f2n.Alloc( numFaceNode );
 
-        int nFNode = gf2n[ gfid ].size();
+    for ( int fid = 0; fid < nFaces; ++ fid )
+    {
+        CsrRow gFaceNode = gf2n[ l2g->l2g_face[ fid ] ];
+        CsrRow faceNode = f2n[ fid ];
 
-        for ( int iNode = 0; iNode < nFNode; ++ iNode )
+        for ( int iNode = 0; iNode < faceNode.size(); ++ iNode )
         {
-            int gnid = gf2n[ gfid ][ iNode ];
-            int nid  = g2l->g2l_node[ gnid ];
-            f2n[ fid ].push_back( nid );
+            faceNode[ iNode ] = l2g->GetLocalNode( gFaceNode[ iNode ] );
         }
     }
 }
 
-void Partition::SetF2CAndBC( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void Partition::SetF2CAndBC( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
     int nGBFace = ggrid->nBFaces;
 
@@ -565,7 +1306,7 @@ void Partition::SetF2CAndBC( UnsGrid * ggrid, int zid, UnsGrid * grid )
 
     for ( int iFace = 0; iFace < nBFaces; ++ iFace )
     {
-        int gfid = this->l2g->l2g_face[ iFace ];
+        int gfid = l2g->l2g_face[ iFace ];
 
         int glc = glCell[ gfid ];
         int grc = grCell[ gfid ];
@@ -606,7 +1347,7 @@ void Partition::SetF2CAndBC( UnsGrid * ggrid, int zid, UnsGrid * grid )
 
     for ( int iFace = nBFaces; iFace < nFaces; ++ iFace )
     {
-        int gfid = this->l2g->l2g_face[ iFace ];
+        int gfid = l2g->l2g_face[ iFace ];
         int glc = glCell[ gfid ];
         int grc = grCell[ gfid ];
 
@@ -618,7 +1359,7 @@ void Partition::SetF2CAndBC( UnsGrid * ggrid, int zid, UnsGrid * grid )
     }
 }
 
-void Partition::SetInterface( UnsGrid * ggrid, int zid, UnsGrid * grid )
+void Partition::SetInterface( L2GMapping * l2g, UnsGrid * ggrid, int zid, UnsGrid * grid )
 {
     if ( this->partition_type != 1 ) return;
 
@@ -626,55 +1367,50 @@ void Partition::SetInterface( UnsGrid * ggrid, int zid, UnsGrid * grid )
     int nIFaces = interFace->nIFaces;
     int nBFaces = grid->nBFaces;
 
-    int nGFace = ggrid->nFaces;
-    int nGBFace = ggrid->nBFaces;
-
     IntField & glCell = ggrid->faceTopo->lCells;
     IntField & grCell = ggrid->faceTopo->rCells;
 
     //number of physical boundary face
     int nPBFace = nBFaces - nIFaces;
 
-    for ( int gfid = nGBFace; gfid < nGFace; ++ gfid )
+    for ( int fid = nPBFace; fid < nBFaces; ++ fid )
     {
-        int fid = this->g2l->g2l_face[ gfid ];
-        if ( fid < nBFaces && fid > - 1 )
-        {
-            //local interface id
-            int ifid = fid - nPBFace;
+        int gfid = l2g->l2g_face[ fid ];
 
-            int glc = glCell[ gfid ];
-            int grc = grCell[ gfid ];
+        //local interface id
+        int ifid = fid - nPBFace;
 
-            int leftZone  = this->g2l->gc2lzone[ glc ];
-            int rightZone = this->g2l->gc2lzone[ grc ];
+        int glc = glCell[ gfid ];
+        int grc = grCell[ gfid ];
 
-            int gcid = -1;
+        int leftZone  = this->g2l->gc2lzone[ glc ];
+        int rightZone = this->g2l->gc2lzone[ grc ];
 
-            if ( leftZone == zid )
-            {
-                interFace->idir[ ifid ] = 1;
-                gcid = grc;
-            }
-            else if ( rightZone == zid )
-            {
-                interFace->idir[ ifid ] = - 1;
-                gcid = glc;
-            }
-            else
-            {
-                std::cout << "error\n";
-            }
-            //interface
-            //   |zone
-            //   |face
-            //   |cell
-            //
-            interFace->zoneId          [ ifid ] = this->g2l->gc2lzone[ gcid ];
-            interFace->localInterfaceId[ ifid ] = this->g2l->g2l_cell[ gcid ];
-            interFace->localCellId     [ ifid ] = this->g2l->g2l_cell[ gcid ];
-            interFace->i2b             [ ifid ] = this->g2l->g2l_face[ gfid ];
+        int gcid = -1;
+
+        if ( leftZone == zid )
+        {
+            interFace->idir[ ifid ] = 1;
+            gcid = grc;
+        }
+        else if ( rightZone == zid )
+        {
+            interFace->idir[ ifid ] = - 1;
+            gcid = glc;
+        }
+        else
+        {
+            std::cout << "error\n";
         }
+        //interface
+        //   |zone
+        //   |face
+        //   |cell
+        //
+        interFace->zoneId          [ ifid ] = this->g2l->gc2lzone[ gcid ];
+        interFace->localInterfaceId[ ifid ] = this->g2l->g2l_cell[ gcid ];
+        interFace->localCellId     [ ifid ] = this->g2l->g2l_cell[ gcid ];
+        interFace->i2b             [ ifid ] = fid;
     }
 }
 
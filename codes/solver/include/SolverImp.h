@@ -27,5 +27,7 @@ License
 BeginNameSpace( ONEFLOW )
 
 void CommInterfaceData();
+void StartInterfaceData();
+bool OverlapInterfaceData();
 
 EndNameSpace
@@ -43,6 +43,10 @@ public:
     std::string resFileName;
     Real residual;
     Real conver;
+    //cell fields of this solver that are allocated as MCField with the given layout
+    std::map< std::string, int > fieldLayout;
+public:
+    int GetFieldLayout( const std::string & fieldName );
 public:
     Real relaxationFactorOfProlongation;
     IntField positiveFlag;
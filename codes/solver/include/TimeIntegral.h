@@ -24,6 +24,7 @@ License
 #pragma once
 #include "Configure.h"
 #include "HXDefine.h"
+#include "TaskGraph.h"
 BeginNameSpace( ONEFLOW )
 
 typedef void ( * TIME_INTEGRAL )( void );
@@ -49,8 +50,16 @@ public:
     ~TimeIntegral();
 public:
     static TIME_INTEGRAL timeIntegral;
+    //the message sequences of one iteration, resolved once
+    static TaskRecipe rkStart;
+    static TaskRecipe rkStage;
+    static TaskRecipe lusgsStart;
+    static TaskRecipe lusgsStartOverlap;
+    static TaskRecipe lusgsSweep;
+    static TaskRecipe lusgsEnd;
 public:
     static void Init();
+    static void InitRecipe();
     static void Relaxation( int nCycles );
 public:
     static void RungeKutta();
@@ -22,6 +22,12 @@ License
 
 #include "SolverImp.h"
 #include "CmxTask.h"
+#include "InterfaceTask.h"
+#include "TimeIntegral.h"
+#include "SolverState.h"
+#include "GridState.h"
+#include "Ctrl.h"
+#include "Stop.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -32,4 +38,30 @@ void CommInterfaceData()
     ONEFLOW::AddCmdToList( "DOWNLOAD_INTERFACE_DATA");
 }
 
+void StartInterfaceData()
+{
+    if ( InterfaceExchange::GetPending( SolverState::tid ) )
+    {
+        Stop( "StartInterfaceData : an interface exchange of this solver is already in flight" );
+    }
+
+    ONEFLOW::AddCmdToList( "UPLOAD_INTERFACE_DATA"  );
+
+    //the messages stay in flight, FinishInterfaceData downloads them when a face loop needs the halo
+    ONEFLOW::AddTaskToList( new CUpdateInterface( true ), "UPDATE_INTERFACE_DATA" );
+}
+
+bool OverlapInterfaceData()
+{
+    if ( ctrl.overlapcomm != 1 ) return false;
+
+    //the halo must not be read before the next residual: one solver, one grid level, LU-SGS, steady
+    if ( SolverState::nSolver != 1 ) return false;
+    if ( GridState::nGrids != 1 ) return false;
+    if ( ctrl.time_integral == MULTI_STAGE || ctrl.time_integral == SIMPLE ) return false;
+    if ( ctrl.idualtime != 0 ) return false;
+
+    return true;
+}
+
 EndNameSpace
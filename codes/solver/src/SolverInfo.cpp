@@ -37,6 +37,17 @@ SolverInfo::~SolverInfo()
     ;
 }
 
+//-1 for fields kept as MRField rows
+int SolverInfo::GetFieldLayout( const std::string & fieldName )
+{
+    std::map< std::string, int >::iterator iter = this->fieldLayout.find( fieldName );
+    if ( iter != this->fieldLayout.end() )
+    {
+        return iter->second;
+    }
+    return -1;
+}
+
 std::map< int, SolverInfo * > * SolverInfoFactory::data = 0;
 
 SolverInfoFactory::SolverInfoFactory()
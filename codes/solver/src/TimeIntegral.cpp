@@ -25,6 +25,7 @@ License
 #include "CmxTask.h"
 #include "GridState.h"
 #include "Ctrl.h"
+#include "InterField.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -41,6 +42,12 @@ SweepState::~SweepState()
 }
 
 TIME_INTEGRAL TimeIntegral::timeIntegral;
+TaskRecipe TimeIntegral::rkStart;
+TaskRecipe TimeIntegral::rkStage;
+TaskRecipe TimeIntegral::lusgsStart;
+TaskRecipe TimeIntegral::lusgsStartOverlap;
+TaskRecipe TimeIntegral::lusgsSweep;
+TaskRecipe TimeIntegral::lusgsEnd;
 
 TimeIntegral::TimeIntegral()
 {
@@ -54,6 +61,8 @@ TimeIntegral::~TimeIntegral()
 
 void TimeIntegral::Init()
 {
+    TimeIntegral::InitRecipe();
+
     if ( ctrl.time_integral == MULTI_STAGE )
     {
         TimeIntegral::timeIntegral = & TimeIntegral::RungeKutta;
@@ -69,6 +78,43 @@ void TimeIntegral::Init()
     
 }
 
+void TimeIntegral::InitRecipe()
+{
+    if ( ! rkStage.Empty() ) return;
+
+    rkStart.Add( "LOAD_Q"         );
+    rkStart.Add( "CALC_TIME_STEP" );
+
+    rkStage.Add( "LOAD_RESIDUALS"   );
+    rkStage.Add( "UPDATE_RESIDUALS" );
+    rkStage.Add( "CALC_LHS"         );
+    rkStage.Add( "UPDATE_FLOWFIELD" );
+    rkStage.Add( "CALC_BOUNDARY"    );
+
+    //the time step does not depend on the residual, INIT_LUSGS waits for both
+    IntField zero( 1, 0 );
+    IntField both( 2 );
+    lusgsStart.Add( "ZERO_DQ_FIELD"    );
+    both[ 0 ] = lusgsStart.Add( "CALC_TIME_STEP", zero );
+    lusgsStart.Add( "LOAD_RESIDUALS", zero );
+    both[ 1 ] = lusgsStart.Add( "UPDATE_RESIDUALS" );
+    lusgsStart.Add( "INIT_LUSGS", both );
+
+    //while the halo exchange is in flight the residual goes first, its face loops complete the exchange
+    lusgsStartOverlap.Add( "ZERO_DQ_FIELD"    );
+    lusgsStartOverlap.Add( "LOAD_RESIDUALS"   );
+    lusgsStartOverlap.Add( "UPDATE_RESIDUALS" );
+    lusgsStartOverlap.Add( "CALC_TIME_STEP"   );
+    lusgsStartOverlap.Add( "INIT_LUSGS"       );
+
+    lusgsSweep.Add( "LUSGS_LOWER_SWEEP"     );
+    lusgsSweep.Add( "EXCHANGE_INTERFACE_DQ" );
+    lusgsSweep.Add( "LUSGS_UPPER_SWEEP"     );
+
+    lusgsEnd.Add( "UPDATE_FLOWFIELD_LUSGS" );
+    lusgsEnd.Add( "CALC_BOUNDARY"          );
+}
+
 void TimeIntegral::Relaxation( int nCycles )
 {
     TimeIntegral::Init();
@@ -82,51 +128,41 @@ void TimeIntegral::RungeKutta()
 {
     if ( GridState::gridLevel == 0 )
     {
-        ONEFLOW::SsSgTask( "LOAD_Q"        );
-        ONEFLOW::SsSgTask( "CALC_TIME_STEP" );
+        rkStart.Run();
 
         int nStages = ctrl.rk_coef.size();
         for ( int iStage = 0; iStage < nStages; ++ iStage )
         {
             ctrl.lhscoef = ctrl.rk_coef[ iStage ];
 
-            ONEFLOW::SsSgTask( "LOAD_RESIDUALS"   );
-            ONEFLOW::SsSgTask( "UPDATE_RESIDUALS" );
-            ONEFLOW::SsSgTask( "CALC_LHS"          );
-            ONEFLOW::SsSgTask( "UPDATE_FLOWFIELD" );
-            ONEFLOW::SsSgTask( "CALC_BOUNDARY"     );
+            rkStage.Run();
         }
     }
     else
     {
         ctrl.lhscoef = 1.0;
-        ONEFLOW::SsSgTask( "LOAD_Q"           );
-        ONEFLOW::SsSgTask( "CALC_TIME_STEP"    );
-        ONEFLOW::SsSgTask( "LOAD_RESIDUALS"   );
-        ONEFLOW::SsSgTask( "UPDATE_RESIDUALS" );
-        ONEFLOW::SsSgTask( "CALC_LHS"          );
-        ONEFLOW::SsSgTask( "UPDATE_FLOWFIELD" );
-        ONEFLOW::SsSgTask( "CALC_BOUNDARY"     );
+        rkStart.Run();
+        rkStage.Run();
     }
 }
 
 void TimeIntegral::Lusgs()
 {
-    ONEFLOW::SsSgTask( "ZERO_DQ_FIELD"    );
-    ONEFLOW::SsSgTask( "CALC_TIME_STEP"    );
-    ONEFLOW::SsSgTask( "LOAD_RESIDUALS"   );
-    ONEFLOW::SsSgTask( "UPDATE_RESIDUALS" );
-    ONEFLOW::SsSgTask( "INIT_LUSGS"       );
+    if ( ONEFLOW::InterfaceDataPending() )
+    {
+        lusgsStartOverlap.Run();
+    }
+    else
+    {
+        lusgsStart.Run();
+    }
 
     for ( int iSweep = 0; iSweep < SweepState::nSweeps; ++ iSweep )
     {
-        ONEFLOW::SsSgTask( "LUSGS_LOWER_SWEEP"     );
-        ONEFLOW::SsSgTask( "EXCHANGE_INTERFACE_DQ" );
-        ONEFLOW::SsSgTask( "LUSGS_UPPER_SWEEP"     );
+        lusgsSweep.Run();
     }
 
-    ONEFLOW::SsSgTask( "UPDATE_FLOWFIELD_LUSGS" );
-    ONEFLOW::SsSgTask( "CALC_BOUNDARY"           );
+    lusgsEnd.Run();
 }
 
 void TimeIntegral::Simple()
@@ -499,13 +499,7 @@ void Mesh::SwapBoundary()
         faceTopo->rPosition[ iFace ] = rPositionSwap[ oldFaceIndex ];
     }
 
-    LinkField faceToNodeSwap = faceTopo->faces;
-
-    for ( int iFace = 0; iFace < nFaces; ++ iFace )
-    {
-        int oldFaceIndex = orderMapping[ iFace ];
-        faceTopo->faces[ iFace ] = faceToNodeSwap[ oldFaceIndex ];
-    }
+    faceTopo->faces.ReOrder( orderMapping );
 
     IntField faceTypeSwap = faceTopo->fTypes;
     for ( int iFace = 0; iFace < nFaces; ++ iFace )
@@ -814,7 +808,7 @@ void Mesh::CalcCellCenterVol3D()
         int lc = faceTopo->lCells[ iFace ];
         int rc = faceTopo->rCells[ iFace ];
 
-        IntField & faceIndex = faceTopo->faces[ iFace ];
+        CsrRow faceIndex = faceTopo->faces[ iFace ];
 
         HXSize_t faceNodeNumber = faceIndex.size();
         for ( HXSize_t iNode = 0; iNode < faceNodeNumber; ++ iNode )
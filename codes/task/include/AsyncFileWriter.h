@@ -0,0 +1,52 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include <deque>
+#include <future>
+#include <string>
+
+BeginNameSpace( ONEFLOW )
+
+class DataBook;
+
+//Writes staged zone records on background threads. A file is first written to a
+//temporary name and renamed when it is complete, in the order the files were submitted.
+//A failed write is returned by the job and stops the run on the submitting thread.
+class AsyncFileWriter
+{
+public:
+    AsyncFileWriter();
+    ~AsyncFileWriter();
+public:
+    static void Submit( const std::string & fileName, HXVector< DataBook * > & books, int maxJobs );
+    static void WaitAll();
+protected:
+    static std::string Write( std::string fileName, std::string tmpFileName, HXVector< DataBook * > books, std::shared_future< std::string > previous );
+    static void Finish();
+protected:
+    static std::deque< std::shared_future< std::string > > jobs;
+    static int nSubmits;
+};
+
+EndNameSpace
@@ -26,6 +26,8 @@ License
 
 BeginNameSpace( ONEFLOW )
 
+class Task;
+
 const int COMM_FUNC = 0;
 const int RECV_FUNC = 1;
 const int MESG_FUNC = 2;
@@ -42,6 +44,7 @@ void GenerateCmdList( int msgId );
 
 void AddCmdToList( const std::string & msgName );
 void AddCmdToList( int taskCode, int solverCode );
+void AddTaskToList( Task * task, const std::string & msgName );
 
 class HXClone;
 HXClone * GetClass( int msgId, int sTid, int msgType );
@@ -50,6 +53,7 @@ void CreateTask( int msgId, int sTid );
 void SetFile( int msgId, int sTid );
 
 void SsSgTask( const std::string & taskName );
+void SsSgTask( int msgId );
 void MsMgTask( const std::string & taskName );
 
 
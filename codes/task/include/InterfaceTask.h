@@ -23,17 +23,57 @@ License
 
 #pragma once
 #include "Task.h"
+#include "HXType.h"
+#include "BasicParallel.h"
+#include <vector>
 BeginNameSpace( ONEFLOW )
 
+class InterfaceExchange
+{
+public:
+    InterfaceExchange( Task * task );
+    ~InterfaceExchange();
+public:
+    void Start();
+    void Finish();
+    static InterfaceExchange * GetExchange( Task * task );
+    static InterfaceExchange * GetPending( int sTid );
+    static void FinishPending( int sTid );
+public:
+    //set while the messages of a deferred CUpdateInterface are in flight
+    bool inFlight;
+    //one exchange per solver and message, kept with its buffers for the whole run
+    static HXVector< InterfaceExchange * > exchanges;
+protected:
+    void CreateExchangePairs();
+    void PackSendData();
+    void PostExchange();
+    void PostExchangeLength();
+    void WaitExchange();
+    void UnpackRecvData();
+    void DeleteExchangeData();
+protected:
+    Task task;
+    int sTid;
+    //the interface maps fix the message sizes, so they are exchanged only the first time
+    bool lengthKnown;
+    //zone pairs this process takes part in, in the global zone/neighbor order
+    std::vector< int > sZones, rZones;
+    std::vector< DataBook * > pairBooks;
+    std::vector< HXLongLong_t > pairLengths;
+    std::vector< PL_HXRequest > requests;
+};
+
 class CUpdateInterface : public Task
 {
 public:
-    CUpdateInterface ();
+    CUpdateInterface ( bool deferred = false );
     ~CUpdateInterface() override;
 public:
     void Run() override;
-protected:
-    void SwapInterfaceData( int iZone, int jZone );
+public:
+    //true: Run only posts the messages, InterfaceExchange::FinishPending of the solver completes them
+    bool deferred;
 };
 
 
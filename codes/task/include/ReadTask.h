@@ -39,6 +39,10 @@ public:
 public:
     void ServerRead();
     void ServerRead( VoidFunc mainAction );
+    void ParallelRead();
+public:
+    //true: the file is a sequence of binary zone records that every process can read in place
+    bool parallelFile;
 };
 
 EndNameSpace
@@ -0,0 +1,89 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+
+
+BeginNameSpace( ONEFLOW )
+
+class HXClone;
+class SimpleTask;
+
+//one message of one solver with its registered classes resolved once
+class TaskNode
+{
+public:
+    TaskNode();
+    ~TaskNode();
+public:
+    int msgId;
+    int sTid;
+    std::string msgName;
+    HXClone * commClass;
+    HXClone * recvClass;
+    HXClone * mesgClass;
+    HXClone * taskClass;
+    HXClone * fileClass;
+    //preallocated when no class of its own builds the task or sets its file
+    SimpleTask * task;
+    bool busy;
+public:
+    void Compile( int msgId, int sTid );
+    HXClone * GetClass( int funcType );
+    void Run();
+};
+
+//all messages of all registered solvers, compiled after the solvers are registered
+class TaskGraph
+{
+public:
+    TaskGraph();
+    ~TaskGraph();
+public:
+    static HXVector< HXVector< TaskNode * > > nodes;
+public:
+    static void Compile();
+    static void Free();
+    static TaskNode * GetNode( int msgId, int sTid );
+};
+
+//a fixed sequence of messages, entry i runs after the entries in deps[ i ]
+class TaskRecipe
+{
+public:
+    TaskRecipe();
+    ~TaskRecipe();
+public:
+    IntField msgIds;
+    //entries of the same level do not depend on each other
+    IntField level;
+    //entries sorted by level, in the order they were added within a level
+    IntField order;
+public:
+    bool Empty() { return msgIds.empty(); }
+    int Add( const std::string & msgName );
+    int Add( const std::string & msgName, IntField & depList );
+    void Run();
+};
+
+EndNameSpace
@@ -36,6 +36,11 @@ public:
 public:
     void ServerWrite();
     void ServerWrite( VoidFunc mainAction );
+    void ParallelWrite();
+    void AsyncWrite();
+public:
+    //true: the file is a sequence of binary zone records that every process can write in place
+    bool parallelFile;
 };
 
 EndNameSpace
@@ -0,0 +1,132 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "AsyncFileWriter.h"
+#include "DataBook.h"
+#include "StrUtil.h"
+#include "HXMath.h"
+#include "Stop.h"
+#include <cstdio>
+#include <fstream>
+
+BeginNameSpace( ONEFLOW )
+
+std::deque< std::shared_future< std::string > > AsyncFileWriter::jobs;
+int AsyncFileWriter::nSubmits = 0;
+
+AsyncFileWriter::AsyncFileWriter()
+{
+    ;
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    ;
+}
+
+void AsyncFileWriter::Submit( const std::string & fileName, HXVector< DataBook * > & books, int maxJobs )
+{
+    //bound the staged copies: wait for the oldest file before taking a new one
+    while ( static_cast< int >( jobs.size() ) >= MAX( maxJobs, 1 ) )
+    {
+        AsyncFileWriter::Finish();
+    }
+
+    std::shared_future< std::string > previous;
+    if ( ! jobs.empty() )
+    {
+        previous = jobs.back();
+    }
+
+    std::string tmpFileName = AddString( fileName, ".", nSubmits, ".tmp" );
+    ++ nSubmits;
+
+    std::shared_future< std::string > job = std::async( std::launch::async, & AsyncFileWriter::Write, fileName, tmpFileName, books, previous ).share();
+    jobs.push_back( job );
+
+    books.resize( 0 );
+}
+
+void AsyncFileWriter::WaitAll()
+{
+    while ( ! jobs.empty() )
+    {
+        AsyncFileWriter::Finish();
+    }
+}
+
+void AsyncFileWriter::Finish()
+{
+    std::string error = jobs.front().get();
+    jobs.pop_front();
+
+    if ( ! error.empty() )
+    {
+        Stop( error );
+    }
+}
+
+std::string AsyncFileWriter::Write( std::string fileName, std::string tmpFileName, HXVector< DataBook * > books, std::shared_future< std::string > previous )
+{
+    std::fstream file( tmpFileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    bool fileOk = static_cast< bool >( file );
+
+    int nBooks = books.size();
+    for ( int iBook = 0; iBook < nBooks; ++ iBook )
+    {
+        if ( fileOk )
+        {
+            books[ iBook ]->WriteFile( file );
+        }
+        delete books[ iBook ];
+    }
+
+    fileOk = fileOk && static_cast< bool >( file );
+    file.close();
+
+    //an older file must not replace a newer one
+    if ( previous.valid() )
+    {
+        previous.wait();
+    }
+
+    if ( ! fileOk )
+    {
+        std::remove( tmpFileName.c_str() );
+        return AddString( "could not write ", tmpFileName, "\n" );
+    }
+
+    if ( std::rename( tmpFileName.c_str(), fileName.c_str() ) != 0 )
+    {
+        //rename does not replace an existing file on every platform
+        std::remove( fileName.c_str() );
+        if ( std::rename( tmpFileName.c_str(), fileName.c_str() ) != 0 )
+        {
+            return AddString( "could not rename ", tmpFileName, " to ", fileName, "\n" );
+        }
+    }
+
+    return "";
+}
+
+EndNameSpace
@@ -38,6 +38,7 @@ License
 #include "Zone.h"
 #include "Grid.h"
 #include "LogFile.h"
+#include "TaskGraph.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -63,13 +64,7 @@ void CmdActionNext()
 
 void GenerateCmdList( int msgId )
 {
-    int sTid = SolverState::tid;
-
-    HXRegister * hxRegister = RegisterFactory::GetRegister( sTid, MESG_FUNC );
-
-    std::string msgName = MessageMap::GetMsgName( msgId );
-
-    HXClone * cloneClass = hxRegister->GetClass( msgName );
+    HXClone * cloneClass = ONEFLOW::GetClass( msgId, SolverState::tid, MESG_FUNC );
 
     if ( cloneClass )
     {
@@ -77,7 +72,7 @@ void GenerateCmdList( int msgId )
     }
     else
     {
-        ONEFLOW::AddCmdToList( msgName );
+        ONEFLOW::AddCmdToList( msgId, SolverState::tid );
     }
 }
 
@@ -101,6 +96,22 @@ void AddCmdToList( int msgId, int sTid )
     CMD::AddCmd( cmd );
 }
 
+//queues a task built by the caller, for tasks that need settings the task map cannot give
+void AddTaskToList( Task * task, const std::string & msgName )
+{
+    task->taskId = MessageMap::GetMsgId( msgName );
+    task->taskName = msgName;
+    task->action     = & ONEFLOW::CmdAction;
+    task->sendAction = & ONEFLOW::CmdAction;
+    task->recvAction = & ONEFLOW::CmdActionNext;
+
+    SimpleCmd * cmd = new SimpleCmd();
+
+    cmd->AddTask( task );
+
+    CMD::AddCmd( cmd );
+}
+
 void SetTaskAction()
 {
     TaskState::task->action     = & ONEFLOW::CmdAction;
@@ -140,26 +151,31 @@ void SetFile( int msgId, int sTid )
 
 HXClone * GetClass( int msgId, int sTid, int msgType )
 {
-    HXRegister * hxRegister = RegisterFactory::GetRegister( sTid, msgType );
-
-    std::string msgName = MessageMap::GetMsgName( msgId );
+    TaskNode * node = TaskGraph::GetNode( msgId, sTid );
 
-    HXClone * cloneClass = hxRegister->GetClass( msgName );
+    if ( ! node ) return 0;
 
-    return cloneClass;
+    return node->GetClass( msgType );
 }
 
 void SsSgTask( const std::string & taskName )
 {
-    int taskCode = MessageMap::GetMsgId( taskName );
+    ONEFLOW::SsSgTask( MessageMap::GetMsgId( taskName ) );
+}
+
+void SsSgTask( int msgId )
+{
+    TaskNode * node = TaskGraph::GetNode( msgId, SolverState::tid );
 
-    ONEFLOW::GenerateCmdList( taskCode );
+    if ( ! node ) return;
 
-    CMD::ExecuteCmd();
+    node->Run();
 }
 
 void MsMgTask( const std::string & taskname )
 {
+    int msgId = MessageMap::GetMsgId( taskname );
+
     for ( int sid = 0; sid < SolverState::nSolver; ++ sid )
     {
         SolverState::SetTidById( sid );
@@ -167,7 +183,7 @@ void MsMgTask( const std::string & taskname )
         for ( int gl = 0; gl < GridState::nGrids; ++ gl )
         {
             GridState::SetGridLevel( gl );
-            ONEFLOW::SsSgTask( taskname );
+            ONEFLOW::SsSgTask( msgId );
         }
     }
 }
@@ -24,6 +24,7 @@ License
 #include "Task.h"
 #include "TaskState.h"
 #include "TimeSpan.h"
+#include "Profiler.h"
 #include <iostream>
 #include <string>
 
@@ -62,6 +63,7 @@ void SimpleCmd::Execute()
     for ( HXSize_t iTask = 0; iTask < tasks->size(); ++ iTask )
     {
         Task * task = ( * tasks )[ iTask ];
+        ProfileScope scope( task->taskName );
         TaskState::task = task;
         task->Run();
     }
@@ -26,15 +26,110 @@ License
 #include "ZoneState.h"
 #include "PIO.h"
 #include "ActionState.h"
+#include "TaskState.h"
+#include "SolverState.h"
 #include "DataBook.h"
 #include "InterFace.h"
+#include "Stop.h"
 
 BeginNameSpace( ONEFLOW )
 
+HXVector< InterfaceExchange * > InterfaceExchange::exchanges;
 
-CUpdateInterface::CUpdateInterface()
+InterfaceExchange::InterfaceExchange( Task * task )
 {
-    ;
+    this->task.taskId     = task->taskId;
+    this->task.taskName   = task->taskName;
+    this->task.action     = task->action;
+    this->task.sendAction = task->sendAction;
+    this->task.recvAction = task->recvAction;
+    this->sTid = SolverState::tid;
+    this->lengthKnown = false;
+    this->inFlight = false;
+
+    this->CreateExchangePairs();
+}
+
+InterfaceExchange::~InterfaceExchange()
+{
+    this->DeleteExchangeData();
+}
+
+InterfaceExchange * InterfaceExchange::GetExchange( Task * task )
+{
+    int nExchanges = InterfaceExchange::exchanges.size();
+    for ( int i = 0; i < nExchanges; ++ i )
+    {
+        InterfaceExchange * exchange = InterfaceExchange::exchanges[ i ];
+        if ( exchange->sTid == SolverState::tid && exchange->task.taskId == task->taskId )
+        {
+            return exchange;
+        }
+    }
+
+    InterfaceExchange * exchange = new InterfaceExchange( task );
+    InterfaceExchange::exchanges.push_back( exchange );
+    return exchange;
+}
+
+void InterfaceExchange::Start()
+{
+    this->PackSendData();
+
+    this->PostExchange();
+}
+
+void InterfaceExchange::Finish()
+{
+    //the receive actions look up the message of the current task, so the
+    //exchange runs under its own task even when it completes inside another one
+    Task * saveTask = TaskState::task;
+    DataBook * saveDataBook = ActionState::dataBook;
+    int saveTid  = SolverState::tid;
+    int saveZid  = ZoneState::zid;
+    int saveSzid = ZoneState::szid;
+
+    TaskState::task  = & this->task;
+    SolverState::tid = this->sTid;
+
+    this->WaitExchange();
+
+    this->UnpackRecvData();
+
+    TaskState::task       = saveTask;
+    ActionState::dataBook = saveDataBook;
+    SolverState::tid      = saveTid;
+    ZoneState::zid        = saveZid;
+    ZoneState::szid       = saveSzid;
+}
+
+InterfaceExchange * InterfaceExchange::GetPending( int sTid )
+{
+    int nExchanges = InterfaceExchange::exchanges.size();
+    for ( int i = 0; i < nExchanges; ++ i )
+    {
+        InterfaceExchange * exchange = InterfaceExchange::exchanges[ i ];
+        if ( exchange->sTid == sTid && exchange->inFlight )
+        {
+            return exchange;
+        }
+    }
+    return 0;
+}
+
+void InterfaceExchange::FinishPending( int sTid )
+{
+    InterfaceExchange * exchange = InterfaceExchange::GetPending( sTid );
+    if ( ! exchange ) return;
+
+    exchange->inFlight = false;
+
+    exchange->Finish();
+}
+
+CUpdateInterface::CUpdateInterface( bool deferred )
+{
+    this->deferred = deferred;
 }
 
 CUpdateInterface::~CUpdateInterface()
@@ -44,44 +139,177 @@ CUpdateInterface::~CUpdateInterface()
 
 void CUpdateInterface::Run()
 {
+    if ( this->deferred && InterfaceExchange::GetPending( SolverState::tid ) )
+    {
+        Stop( "CUpdateInterface::Run : an interface exchange of this solver is already in flight" );
+    }
+
+    InterfaceExchange::FinishPending( SolverState::tid );
+
+    InterfaceExchange * exchange = InterfaceExchange::GetExchange( this );
+
+    exchange->Start();
+
     ActionState::dataBook = this->dataBook;
-    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+
+    if ( this->deferred )
     {
-        ZoneState::zid = zId;
+        exchange->inFlight = true;
+        return;
+    }
+
+    exchange->Finish();
+}
+
+void InterfaceExchange::CreateExchangePairs()
+{
+    this->DeleteExchangeData();
 
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
         int nNei = Zone::GetNumberOfZoneNeighbors( zId );
 
         for ( int iNei = 0; iNei < nNei; ++ iNei )
         {
             int jZone = Zone::GetNeighborZoneId( zId, iNei );
 
-            this->SwapInterfaceData( zId, jZone );
+            int sPid = ZoneState::pid[ zId   ];
+            int rPid = ZoneState::pid[ jZone ];
+
+            if ( Parallel::pid != sPid && Parallel::pid != rPid ) continue;
+
+            this->sZones.push_back( zId   );
+            this->rZones.push_back( jZone );
+            this->pairBooks.push_back( new DataBook() );
+            this->pairLengths.push_back( 0 );
         }
     }
 }
 
-void CUpdateInterface::SwapInterfaceData( int iZone, int jZone )
+void InterfaceExchange::PackSendData()
 {
-    int sPid = ZoneState::pid[ iZone ];
-    int rPid = ZoneState::pid[ jZone ];
-
-    if ( Parallel::pid == sPid )
+    int nPairs = this->sZones.size();
+    for ( int iPair = 0; iPair < nPairs; ++ iPair )
     {
+        int iZone = this->sZones[ iPair ];
+        int jZone = this->rZones[ iPair ];
+
+        if ( Parallel::pid != ZoneState::pid[ iZone ] ) continue;
+
+        //the book keeps its memory, so packing into it again allocates nothing
+        DataBook * dataBook = this->pairBooks[ iPair ];
+        dataBook->MoveToBegin();
+        dataBook->ReSize( 0 );
+
+        ActionState::dataBook = dataBook;
         ZoneState::zid  = iZone;
         ZoneState::rzid = jZone;
 
-        this->sendAction();
+        this->task.sendAction();
+
+        HXLongLong_t nLength = dataBook->GetSize();
+        if ( this->lengthKnown && nLength != this->pairLengths[ iPair ] )
+        {
+            Stop( "the size of an interface message changed between two exchanges\n" );
+        }
+        this->pairLengths[ iPair ] = nLength;
+    }
+}
+
+void InterfaceExchange::PostExchange()
+{
+    if ( ! this->lengthKnown )
+    {
+        this->PostExchangeLength();
     }
 
-    HXSwapData( ActionState::dataBook, sPid, rPid );
+    //one message per neighbor pair: the book is a single page below maxUnitSize
+    int nPairs = this->sZones.size();
+    for ( int iPair = 0; iPair < nPairs; ++ iPair )
+    {
+        int sPid = ZoneState::pid[ this->sZones[ iPair ] ];
+        int rPid = ZoneState::pid[ this->rZones[ iPair ] ];
 
-    if ( Parallel::pid == rPid )
+        if ( sPid == rPid ) continue;
+
+        if ( Parallel::pid == sPid )
+        {
+            ONEFLOW::HXISendData( this->pairBooks[ iPair ], rPid, this->requests );
+        }
+        else
+        {
+            ONEFLOW::HXIRecvData( this->pairBooks[ iPair ], this->pairLengths[ iPair ], sPid, this->requests );
+        }
+    }
+}
+
+void InterfaceExchange::PostExchangeLength()
+{
+    //both sides walk the pairs in the same order, so messages between two processes match in posting order
+    int nPairs = this->sZones.size();
+    for ( int iPair = 0; iPair < nPairs; ++ iPair )
     {
+        int sPid = ZoneState::pid[ this->sZones[ iPair ] ];
+        int rPid = ZoneState::pid[ this->rZones[ iPair ] ];
+
+        if ( sPid == rPid ) continue;
+
+        this->requests.push_back( PL_REQUEST_NULL );
+        if ( Parallel::pid == sPid )
+        {
+            ONEFLOW::HXISend( & this->pairLengths[ iPair ], 1, PL_LONG_LONG_INT, rPid, & this->requests.back() );
+        }
+        else
+        {
+            ONEFLOW::HXIRecv( & this->pairLengths[ iPair ], 1, PL_LONG_LONG_INT, sPid, & this->requests.back() );
+        }
+    }
+
+    this->WaitExchange();
+
+    this->lengthKnown = true;
+}
+
+void InterfaceExchange::WaitExchange()
+{
+    int nRequests = this->requests.size();
+    if ( nRequests > 0 )
+    {
+        ONEFLOW::HXWait( nRequests, & this->requests[ 0 ] );
+    }
+    this->requests.resize( 0 );
+}
+
+void InterfaceExchange::UnpackRecvData()
+{
+    int nPairs = this->sZones.size();
+    for ( int iPair = 0; iPair < nPairs; ++ iPair )
+    {
+        int iZone = this->sZones[ iPair ];
+        int jZone = this->rZones[ iPair ];
+
+        if ( Parallel::pid != ZoneState::pid[ jZone ] ) continue;
+
+        ActionState::dataBook = this->pairBooks[ iPair ];
         ZoneState::zid  = jZone;
         ZoneState::szid = iZone;
 
-        this->recvAction();
+        this->task.recvAction();
+    }
+}
+
+void InterfaceExchange::DeleteExchangeData()
+{
+    int nPairs = this->pairBooks.size();
+    for ( int iPair = 0; iPair < nPairs; ++ iPair )
+    {
+        delete this->pairBooks[ iPair ];
     }
+    this->sZones.resize( 0 );
+    this->rZones.resize( 0 );
+    this->pairBooks.resize( 0 );
+    this->pairLengths.resize( 0 );
+    this->requests.resize( 0 );
 }
 
 EndNameSpace
@@ -28,11 +28,14 @@ License
 #include "ActionState.h"
 #include "DataBook.h"
 #include "InterFace.h"
+#include "Ctrl.h"
+#include "AsyncFileWriter.h"
 
 BeginNameSpace( ONEFLOW )
 
 CReadFile::CReadFile()
 {
+    parallelFile = false;
 }
 
 CReadFile::~CReadFile()
@@ -41,10 +44,20 @@ CReadFile::~CReadFile()
 
 void CReadFile::Run()
 {
+    //a file may still be on its way to the disk
+    AsyncFileWriter::WaitAll();
+
     ActionState::dataBook = this->dataBook;
     if ( Parallel::mode == 0 )
     {
-        this->ServerRead();
+        if ( this->parallelFile && ctrl.parallelio == 1 && Parallel::nProc > 1 )
+        {
+            this->ParallelRead();
+        }
+        else
+        {
+            this->ServerRead();
+        }
     }
 }
 
@@ -83,4 +96,44 @@ void CReadFile::ServerRead( VoidFunc mainAction )
     }
 }
 
+void CReadFile::ParallelRead()
+{
+    int nZones = ZoneState::nZones;
+
+    HXVector< HXLongLong_t > zoneLength( nZones, 0 );
+    HXVector< HXLongLong_t > zoneOffset( nZones, 0 );
+
+    PL_File file;
+    PIO::ParallelOpenPrjFile( & file, false );
+
+    //the record lengths index the file: the file server walks them and hands the offsets to everyone
+    int fid = Parallel::GetFid();
+    if ( Parallel::pid == fid )
+    {
+        HXLongLong_t offset = 0;
+        for ( int zId = 0; zId < nZones; ++ zId )
+        {
+            zoneOffset[ zId ] = offset;
+            ONEFLOW::HXFileReadAt( & file, offset, & zoneLength[ zId ], sizeof( HXLongLong_t ) );
+            offset += sizeof( HXLongLong_t ) + zoneLength[ zId ];
+        }
+    }
+
+    ONEFLOW::HXBcast( & zoneLength[ 0 ], nZones, fid );
+    ONEFLOW::HXBcast( & zoneOffset[ 0 ], nZones, fid );
+
+    for ( int zId = 0; zId < nZones; ++ zId )
+    {
+        if ( Parallel::pid != ZoneState::pid[ zId ] ) continue;
+
+        ZoneState::zid = zId;
+
+        ONEFLOW::HXReadDataAt( & file, zoneOffset[ zId ], zoneLength[ zId ], ActionState::dataBook );
+
+        this->action();
+    }
+
+    PIO::ParallelCloseFile( & file );
+}
+
 EndNameSpace
@@ -0,0 +1,240 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "TaskGraph.h"
+#include "CmxTask.h"
+#include "SimpleTask.h"
+#include "Command.h"
+#include "Register.h"
+#include "Message.h"
+#include "HXClone.h"
+#include "TaskState.h"
+#include "SolverState.h"
+#include "DataBook.h"
+#include "HXMath.h"
+#include "Profiler.h"
+#include "Stop.h"
+#include <map>
+
+BeginNameSpace( ONEFLOW )
+
+TaskNode::TaskNode()
+{
+    msgId = -1;
+    sTid = -1;
+    commClass = 0;
+    recvClass = 0;
+    mesgClass = 0;
+    taskClass = 0;
+    fileClass = 0;
+    task = 0;
+    busy = false;
+}
+
+TaskNode::~TaskNode()
+{
+    delete task;
+}
+
+void TaskNode::Compile( int msgId, int sTid )
+{
+    this->msgId = msgId;
+    this->sTid = sTid;
+    this->msgName = MessageMap::GetMsgName( msgId );
+
+    this->commClass = RegisterFactory::GetRegister( sTid, COMM_FUNC )->GetClass( msgName );
+    this->recvClass = RegisterFactory::GetRegister( sTid, RECV_FUNC )->GetClass( msgName );
+    this->mesgClass = RegisterFactory::GetRegister( sTid, MESG_FUNC )->GetClass( msgName );
+    this->taskClass = RegisterFactory::GetRegister( sTid, TASK_FUNC )->GetClass( msgName );
+    this->fileClass = RegisterFactory::GetRegister( sTid, FILE_FUNC )->GetClass( msgName );
+
+    if ( mesgClass || taskClass || fileClass ) return;
+
+    task = new SimpleTask();
+    task->taskId = msgId;
+    task->taskName = msgName;
+    task->action     = & ONEFLOW::CmdAction;
+    task->sendAction = & ONEFLOW::CmdAction;
+    task->recvAction = & ONEFLOW::CmdActionNext;
+}
+
+HXClone * TaskNode::GetClass( int funcType )
+{
+    if ( funcType == COMM_FUNC ) return commClass;
+    if ( funcType == RECV_FUNC ) return recvClass;
+    if ( funcType == MESG_FUNC ) return mesgClass;
+    if ( funcType == TASK_FUNC ) return taskClass;
+    if ( funcType == FILE_FUNC ) return fileClass;
+    return 0;
+}
+
+void TaskNode::Run()
+{
+    if ( mesgClass )
+    {
+        //composite messages decide their tasks at run time
+        ProfileScope scope( msgName );
+        mesgClass->Solve();
+        CMD::ExecuteCmd();
+        return;
+    }
+
+    //a nested call of the same message falls back to a task of its own
+    if ( task && ! busy )
+    {
+        ProfileScope scope( msgName );
+        busy = true;
+        task->dataBook->ReSize( 0 );
+        task->dataBook->MoveToBegin();
+        SolverState::tid = sTid;
+        TaskState::task = task;
+        task->Run();
+        busy = false;
+        return;
+    }
+
+    ONEFLOW::AddCmdToList( msgId, sTid );
+    CMD::ExecuteCmd();
+}
+
+HXVector< HXVector< TaskNode * > > TaskGraph::nodes;
+
+TaskGraph::TaskGraph()
+{
+    ;
+}
+
+TaskGraph::~TaskGraph()
+{
+    ;
+}
+
+void TaskGraph::Compile()
+{
+    if ( ! RegisterFactory::data || ! MessageMap::idMap ) return;
+
+    std::map< int, MRegister * >::iterator iter;
+    for ( iter = RegisterFactory::data->begin(); iter != RegisterFactory::data->end(); ++ iter )
+    {
+        int sTid = iter->first;
+        std::map< int, std::string >::iterator msgIter;
+        for ( msgIter = MessageMap::idMap->begin(); msgIter != MessageMap::idMap->end(); ++ msgIter )
+        {
+            TaskGraph::GetNode( msgIter->first, sTid );
+        }
+    }
+}
+
+void TaskGraph::Free()
+{
+    for ( HXSize_t i = 0; i < nodes.size(); ++ i )
+    {
+        for ( HXSize_t j = 0; j < nodes[ i ].size(); ++ j )
+        {
+            delete nodes[ i ][ j ];
+        }
+    }
+    nodes.resize( 0 );
+}
+
+//messages registered after Compile are resolved on their first call
+TaskNode * TaskGraph::GetNode( int msgId, int sTid )
+{
+    if ( msgId < 0 || sTid < 0 ) return 0;
+
+    if ( sTid >= static_cast<int>( nodes.size() ) )
+    {
+        nodes.resize( sTid + 1 );
+    }
+
+    HXVector< TaskNode * > & list = nodes[ sTid ];
+    if ( msgId >= static_cast<int>( list.size() ) )
+    {
+        list.resize( msgId + 1, 0 );
+    }
+
+    if ( ! list[ msgId ] )
+    {
+        TaskNode * node = new TaskNode();
+        node->Compile( msgId, sTid );
+        list[ msgId ] = node;
+    }
+
+    return list[ msgId ];
+}
+
+TaskRecipe::TaskRecipe()
+{
+    ;
+}
+
+TaskRecipe::~TaskRecipe()
+{
+    ;
+}
+
+int TaskRecipe::Add( const std::string & msgName )
+{
+    IntField depList;
+    if ( ! msgIds.empty() )
+    {
+        depList.push_back( msgIds.size() - 1 );
+    }
+    return this->Add( msgName, depList );
+}
+
+int TaskRecipe::Add( const std::string & msgName, IntField & depList )
+{
+    int id = msgIds.size();
+    int lev = 0;
+    for ( HXSize_t i = 0; i < depList.size(); ++ i )
+    {
+        if ( depList[ i ] < 0 || depList[ i ] >= id )
+        {
+            Stop( "TaskRecipe::Add : " + msgName + " depends on an entry that is not added yet" );
+        }
+        lev = MAX( lev, level[ depList[ i ] ] + 1 );
+    }
+
+    msgIds.push_back( MessageMap::GetMsgId( msgName ) );
+    level.push_back( lev );
+
+    int pos = order.size();
+    while ( pos > 0 && level[ order[ pos - 1 ] ] > lev )
+    {
+        -- pos;
+    }
+    order.insert( order.begin() + pos, id );
+    return id;
+}
+
+//a level runs after all lower levels, so every entry runs after its dependencies
+void TaskRecipe::Run()
+{
+    int nEntries = order.size();
+    for ( int i = 0; i < nEntries; ++ i )
+    {
+        ONEFLOW::SsSgTask( msgIds[ order[ i ] ] );
+    }
+}
+
+EndNameSpace
@@ -46,6 +46,7 @@ void ReadBinaryFileTask( StringField & data )
 {
     CReadFile * task = new CReadFile();
     task->mainAction = & ReadBinaryFile;
+    task->parallelFile = true;
     TaskState::task = task;
 }
 
@@ -53,6 +54,7 @@ void WriteBinaryFileTask( StringField & data )
 {
     CWriteFile * task = new CWriteFile();
     task->mainAction = & WriteBinaryFile;
+    task->parallelFile = true;
     TaskState::task = task;
 }
 
@@ -29,6 +29,9 @@ License
 #include "DataBase.h"
 #include "DataBook.h"
 #include "InterFace.h"
+#include "Ctrl.h"
+#include "Prj.h"
+#include "AsyncFileWriter.h"
 #include <iostream>
 
 
@@ -36,6 +39,7 @@ BeginNameSpace( ONEFLOW )
 
 CWriteFile::CWriteFile()
 {
+    parallelFile = false;
 }
 
 CWriteFile::~CWriteFile()
@@ -47,7 +51,18 @@ void CWriteFile::Run()
 	ActionState::dataBook = this->dataBook;
 	if ( Parallel::mode == 0 )
 	{
-		this->ServerWrite();
+		if ( this->parallelFile && ctrl.parallelio == 1 && Parallel::nProc > 1 )
+		{
+			this->ParallelWrite();
+		}
+		else if ( this->parallelFile && ctrl.asyncdump > 0 )
+		{
+			this->AsyncWrite();
+		}
+		else
+		{
+			this->ServerWrite();
+		}
 	}
 }
 
@@ -86,5 +101,93 @@ void CWriteFile::ServerWrite( VoidFunc mainAction )
     }
 }
 
+void CWriteFile::AsyncWrite()
+{
+    //stage every zone record on the server, the disk write runs behind the iterations
+    HXVector< DataBook * > zoneBooks;
+
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        ZoneState::zid = zId;
+
+        int sPid = ZoneState::pid[ ZoneState::zid ];
+        int rPid = Parallel::serverid;
+
+        DataBook * dataBook = new DataBook();
+        ActionState::dataBook = dataBook;
+
+        if ( Parallel::pid == sPid )
+        {
+            this->action();
+        }
+
+        HXSwapData( dataBook, sPid, rPid );
+
+        if ( Parallel::pid == rPid )
+        {
+            zoneBooks.push_back( dataBook );
+        }
+        else
+        {
+            delete dataBook;
+        }
+    }
+
+    if ( Parallel::pid == Parallel::serverid )
+    {
+        std::string prjFileName = PIO::GetTaskPrjFileName();
+        Prj::CreateDirIfNeeded( prjFileName );
+
+        AsyncFileWriter::Submit( prjFileName, zoneBooks, ctrl.asyncdump );
+    }
+
+    ActionState::dataBook = this->dataBook;
+}
+
+void CWriteFile::ParallelWrite()
+{
+    int nZones = ZoneState::nZones;
+
+    HXVector< DataBook * > zoneBooks( nZones, 0 );
+    HXVector< HXLongLong_t > localLength( nZones, 0 );
+    HXVector< HXLongLong_t > zoneLength( nZones, 0 );
+
+    for ( int zId = 0; zId < nZones; ++ zId )
+    {
+        if ( Parallel::pid != ZoneState::pid[ zId ] ) continue;
+
+        ZoneState::zid = zId;
+
+        zoneBooks[ zId ] = new DataBook();
+        ActionState::dataBook = zoneBooks[ zId ];
+
+        this->action();
+
+        localLength[ zId ] = zoneBooks[ zId ]->GetSize();
+    }
+
+    //every zone has one owner, so the sum hands all record lengths to every process
+    ONEFLOW::HXReduceLongLong( & localLength[ 0 ], & zoneLength[ 0 ], nZones, PL_SUM );
+
+    PL_File file;
+    PIO::ParallelOpenPrjFile( & file, true );
+
+    //same layout as ServerWrite: one record per zone, its length followed by its bytes
+    HXLongLong_t offset = 0;
+    for ( int zId = 0; zId < nZones; ++ zId )
+    {
+        if ( zoneBooks[ zId ] )
+        {
+            ONEFLOW::HXWriteDataAt( & file, offset, zoneBooks[ zId ] );
+            delete zoneBooks[ zId ];
+        }
+        offset += sizeof( HXLongLong_t ) + zoneLength[ zId ];
+    }
+
+    PIO::ParallelCloseFile( & file );
+
+    ActionState::dataBook = this->dataBook;
+}
+
 
 EndNameSpace
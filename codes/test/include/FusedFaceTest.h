@@ -0,0 +1,49 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include "HXArray.h"
+
+BeginNameSpace( ONEFLOW )
+
+//Compare the fused face states and face fluxes (fuserecon, fusef2c) with the stored
+//qf1/qf2 and invflux paths on the zones of an ns case, with more equations than the base five
+class FusedFaceTest
+{
+public:
+    FusedFaceTest();
+    ~FusedFaceTest();
+public:
+    int nTestEqu;
+    Real tolerance;
+    int nCheckFaces;
+    int nFail;
+public:
+    void Run();
+protected:
+    void CheckFaceStates();
+    void CheckFaceFlux();
+    void FillField( MRField * field, int nElem, Real base, Real scale );
+};
+
+EndNameSpace
@@ -0,0 +1,45 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+
+BeginNameSpace( ONEFLOW )
+
+//Allocate the ns fields of a multi-zone case, exchange the contiguous dq through the
+//interface buffers and compare every first-layer ghost cell with its donor cell
+class InterfaceDqTest
+{
+public:
+    InterfaceDqTest();
+    ~InterfaceDqTest();
+public:
+    int nCheckFaces;
+public:
+    void Run();
+protected:
+    void FillDq();
+    void ExchangeDq();
+    void CheckGhostDq();
+};
+
+EndNameSpace
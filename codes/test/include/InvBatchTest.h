@@ -0,0 +1,53 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include "NsInvBatch.h"
+#include <string>
+
+BeginNameSpace( ONEFLOW )
+
+class NsInv;
+class GCom;
+class NsInvFlux;
+
+//Compare the batch flux schemes with the scalar NsInvFlux schemes on the same random faces
+class InvBatchTest
+{
+public:
+    InvBatchTest();
+    ~InvBatchTest();
+public:
+    int nFaces;
+    Real tolerance;
+    unsigned int seed;
+public:
+    void Run();
+protected:
+    typedef void ( NsInvFlux:: * ScalarPointer )( NsInv & inv, GCom & gcom );
+    bool Compare( const std::string & name, InvFluxBatchPointer batchScheme, ScalarPointer scalarScheme );
+    Real Random( Real a, Real b );
+    void SetRandomFace( NsInvBatch & batch, int i );
+};
+
+EndNameSpace
@@ -0,0 +1,48 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include "HXArray.h"
+#include <string>
+
+BeginNameSpace( ONEFLOW )
+
+//Check the MCField storage against MRField: copy round-trips, layout switches, row views and padding
+class MFieldTest
+{
+public:
+    MFieldTest();
+    ~MFieldTest();
+public:
+    int nFail;
+public:
+    void Run();
+protected:
+    void CheckRoundTrip( int nEqu, int nCells, int layout, int align );
+    void CheckSetLayout( int nEqu, int nCells, int align );
+    void CheckPadding( int nEqu, int nCells, int layout, int align );
+    void FillField( MRField & field, int nEqu, int nCells );
+    void Check( bool flag, const std::string & name, int nEqu, int nCells, int layout, int align );
+};
+
+EndNameSpace
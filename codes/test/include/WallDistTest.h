@@ -0,0 +1,46 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+
+BeginNameSpace( ONEFLOW )
+
+//Compare the wall distance of the walldist task with the exhaustive search over every wall face,
+//then move the wall slightly and compare the incremental update with a full search
+class WallDistTest
+{
+public:
+    WallDistTest();
+    ~WallDistTest();
+public:
+    int nCheckCells;
+    int nTieCells;
+public:
+    void Run();
+protected:
+    void CheckExhaustive();
+    void CheckMovedWall();
+    void MoveWall( Real amplitude, Real waveNumber );
+};
+
+EndNameSpace
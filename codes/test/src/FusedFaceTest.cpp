@@ -0,0 +1,233 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "FusedFaceTest.h"
+#include "System.h"
+#include "FieldSimu.h"
+#include "MultiBlock.h"
+#include "SolverMap.h"
+#include "SolverDef.h"
+#include "SolverState.h"
+#include "Zone.h"
+#include "ZoneState.h"
+#include "UCom.h"
+#include "UNsCom.h"
+#include "NsCom.h"
+#include "UNsLimiter.h"
+#include "UNsInvFlux.h"
+#include "NsInvFlux.h"
+#include "Com.h"
+#include "HXMath.h"
+#include "Parallel.h"
+#include "Stop.h"
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+FusedFaceTest::FusedFaceTest()
+{
+    nTestEqu = 7;
+    //the stored path sums the face fluxes in another order than the fused one when threaded
+    tolerance = 1.0e-12;
+    nCheckFaces = 0;
+    nFail = 0;
+}
+
+FusedFaceTest::~FusedFaceTest()
+{
+    ;
+}
+
+void FusedFaceTest::Run()
+{
+    //needs an ns case, the two extra equations stand in for species beyond the base five
+    ConstructSystemMap();
+    InitFlowSimuGlobal();
+    MultiBlock::LoadGridAndBuildLink();
+    MultiBlock::ProcessFlowWallDist();
+    SolverMap::CreateSolvers();
+    InitializeSolver();
+
+    SolverState::tid = NS_SOLVER;
+
+    int saveTEqu = nscom.nTEqu;
+    nscom.nTEqu = nTestEqu;
+
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        ug.Init();
+        unsf.Init();
+
+        this->CheckFaceStates();
+
+        this->CheckFaceFlux();
+
+        nCheckFaces += ug.nFaces;
+    }
+
+    nscom.nTEqu = saveTEqu;
+
+    if ( nFail > 0 )
+    {
+        Stop( "fused_face: the fused and stored face values differ\n" );
+    }
+
+    std::cout << " fused_face: pid = " << Parallel::pid << " nEqu = " << nTestEqu << " faces = " << nCheckFaces << " passed\n";
+}
+
+void FusedFaceTest::FillField( MRField * field, int nElem, Real base, Real scale )
+{
+    //smooth in the cell index, different in every equation
+    for ( int iEqu = 0; iEqu < nTestEqu; ++ iEqu )
+    {
+        for ( int i = 0; i < nElem; ++ i )
+        {
+            ( * field )[ iEqu ][ i ] = base + scale * sin( 0.37 * i + 1.1 * iEqu );
+        }
+    }
+}
+
+void FusedFaceTest::CheckFaceStates()
+{
+    MRField * q       = new MRField( nTestEqu, ug.nTCell );
+    MRField * dqdx    = new MRField( nTestEqu, ug.nTCell );
+    MRField * dqdy    = new MRField( nTestEqu, ug.nTCell );
+    MRField * dqdz    = new MRField( nTestEqu, ug.nTCell );
+    MRField * limiter = new MRField( nTestEqu, ug.nTCell );
+    MRField * bc_q    = new MRField( nTestEqu, ug.nBFaces );
+
+    this->FillField( q      , ug.nTCell , 1.0, 0.2 );
+    this->FillField( dqdx   , ug.nTCell , 0.0, 0.5 );
+    this->FillField( dqdy   , ug.nTCell , 0.0, 0.5 );
+    this->FillField( dqdz   , ug.nTCell , 0.0, 0.5 );
+    this->FillField( limiter, ug.nTCell , 0.5, 0.5 );
+    this->FillField( bc_q   , ug.nBFaces, 1.0, 0.1 );
+
+    MRField * save_bc_q = unsf.bc_q;
+    unsf.bc_q = bc_q;
+
+    NsLimField limf;
+    limf.nEqu    = nTestEqu;
+    limf.q       = q;
+    limf.dqdx    = dqdx;
+    limf.dqdy    = dqdy;
+    limf.dqdz    = dqdz;
+    limf.limiter = limiter;
+    limf.ckfun   = & NsCheckFunction;
+    limf.qf1     = new MRField( nTestEqu, ug.nFaces );
+    limf.qf2     = new MRField( nTestEqu, ug.nFaces );
+
+    //the stored path of UNsInvFlux::CalcInvFace
+    limf.GetQlQr();
+    limf.CalcFaceValue();
+    limf.BcQlQrFix();
+
+    RealField ql( nTestEqu ), qr( nTestEqu );
+    for ( int fId = 0; fId < ug.nFaces; ++ fId )
+    {
+        limf.CalcFaceQlQr( fId, ql, qr );
+
+        for ( int iEqu = 0; iEqu < nTestEqu; ++ iEqu )
+        {
+            if ( ql[ iEqu ] != ( * limf.qf1 )[ iEqu ][ fId ] || qr[ iEqu ] != ( * limf.qf2 )[ iEqu ][ fId ] )
+            {
+                std::cout << " fused_face: zone " << ZoneState::zid << " face " << fId << " equation " << iEqu;
+                std::cout << " fused " << ql[ iEqu ] << " " << qr[ iEqu ];
+                std::cout << " stored " << ( * limf.qf1 )[ iEqu ][ fId ] << " " << ( * limf.qf2 )[ iEqu ][ fId ] << "\n";
+                ++ nFail;
+            }
+        }
+    }
+
+    unsf.bc_q = save_bc_q;
+
+    delete q;
+    delete dqdx;
+    delete dqdy;
+    delete dqdz;
+    delete limiter;
+    delete bc_q;
+}
+
+void FusedFaceTest::CheckFaceFlux()
+{
+    MRField * invflux   = new MRField( nTestEqu, ug.nFaces );
+    MRField * resStored = new MRField( nTestEqu, ug.nTCell );
+    MRField * resFused  = new MRField( nTestEqu, ug.nTCell );
+
+    UNsInvFlux unsInvFlux;
+    NsInv faceInv;
+    GCom faceGeom;
+    faceInv.Init();
+
+    //the stored path writes invflux and adds it to the cells afterwards
+    unsInvFlux.invflux = invflux;
+    unsInvFlux.res     = 0;
+    for ( int fId = 0; fId < ug.nFaces; ++ fId )
+    {
+        faceGeom.farea = ( * ug.farea )[ fId ];
+        for ( int iEqu = 0; iEqu < nTestEqu; ++ iEqu )
+        {
+            faceInv.flux[ iEqu ] = sin( 0.37 * fId + 1.1 * iEqu );
+        }
+        unsInvFlux.UpdateFaceInvFlux( fId, faceInv, faceGeom );
+    }
+    ONEFLOW::AddF2CField( resStored, invflux );
+
+    //the fused path adds every face flux straight into the residual
+    unsInvFlux.invflux = 0;
+    unsInvFlux.res     = resFused;
+    for ( int fId = 0; fId < ug.nFaces; ++ fId )
+    {
+        faceGeom.farea = ( * ug.farea )[ fId ];
+        for ( int iEqu = 0; iEqu < nTestEqu; ++ iEqu )
+        {
+            faceInv.flux[ iEqu ] = sin( 0.37 * fId + 1.1 * iEqu );
+        }
+        unsInvFlux.UpdateFaceInvFlux( fId, faceInv, faceGeom );
+    }
+    unsInvFlux.res = 0;
+
+    for ( int cId = 0; cId < ug.nCells; ++ cId )
+    {
+        for ( int iEqu = 0; iEqu < nTestEqu; ++ iEqu )
+        {
+            Real vs = ( * resStored )[ iEqu ][ cId ];
+            Real vf = ( * resFused  )[ iEqu ][ cId ];
+            if ( ABS( vs - vf ) > tolerance * ( one + ABS( vs ) ) )
+            {
+                std::cout << " fused_face: zone " << ZoneState::zid << " cell " << cId << " equation " << iEqu;
+                std::cout << " fused res " << vf << " stored res " << vs << "\n";
+                ++ nFail;
+            }
+        }
+    }
+
+    delete invflux;
+    delete resStored;
+    delete resFused;
+}
+
+EndNameSpace
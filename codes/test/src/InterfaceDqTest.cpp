@@ -0,0 +1,222 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "InterfaceDqTest.h"
+#include "System.h"
+#include "FieldSimu.h"
+#include "MultiBlock.h"
+#include "SolverMap.h"
+#include "SolverDef.h"
+#include "SolverState.h"
+#include "Zone.h"
+#include "ZoneState.h"
+#include "UnsGrid.h"
+#include "FaceTopo.h"
+#include "InterFace.h"
+#include "InterField.h"
+#include "InterfaceTask.h"
+#include "FieldRecord.h"
+#include "FieldImp.h"
+#include "DataBase.h"
+#include "DataStorage.h"
+#include "MField.h"
+#include "Parallel.h"
+#include "Stop.h"
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+Real InterfaceDqValue( int zId, int cId, int iEqu )
+{
+    return 1.0e6 * zId + 10.0 * cId + iEqu;
+}
+
+//send and receive actions of the test exchange, the same calls as CPrepareInterfaceField
+void SendInterfaceDq()
+{
+    FieldRecord * fieldRecord = new FieldRecord();
+    PrepareInterfaceFieldRecord( NS_SOLVER, INTERFACE_DQ_DATA, GREAT_SEND, fieldRecord );
+    SetInterfaceFieldData( GREAT_SEND, fieldRecord );
+    delete fieldRecord;
+}
+
+void RecvInterfaceDq()
+{
+    FieldRecord * fieldRecord = new FieldRecord();
+    PrepareInterfaceFieldRecord( NS_SOLVER, INTERFACE_DQ_DATA, GREAT_RECV, fieldRecord );
+    SetInterfaceFieldData( GREAT_RECV, fieldRecord );
+    delete fieldRecord;
+}
+
+InterfaceDqTest::InterfaceDqTest()
+{
+    nCheckFaces = 0;
+}
+
+InterfaceDqTest::~InterfaceDqTest()
+{
+    ;
+}
+
+void InterfaceDqTest::Run()
+{
+    //needs an ns case of at least two zones, e.g. a partitioned grid run on one or more processes
+    ConstructSystemMap();
+    InitFlowSimuGlobal();
+    MultiBlock::LoadGridAndBuildLink();
+    MultiBlock::ProcessFlowWallDist();
+    SolverMap::CreateSolvers();
+    InitializeSolver();
+
+    SolverState::tid = NS_SOLVER;
+
+    this->FillDq();
+
+    this->ExchangeDq();
+
+    this->CheckGhostDq();
+
+    int nFaces = nCheckFaces;
+    int gnFaces = nFaces;
+    HXReduceInt( & nFaces, & gnFaces, 1, PL_SUM );
+    if ( gnFaces == 0 )
+    {
+        Stop( "iface_dq: the case has no interfaces\n" );
+    }
+
+    std::cout << " iface_dq: pid = " << Parallel::pid << " interface faces = " << nCheckFaces << " passed\n";
+}
+
+void InterfaceDqTest::FillDq()
+{
+    //the handles stop if dq or its buffers are not stored as MCField
+    FieldHandle< MCField > dqHandle( "dq" );
+    FieldHandle< MRField > qHandle( "q" );
+
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        MCField & dq = ONEFLOW::GetFieldReference( grid, dqHandle );
+
+        int nEqu = dq.GetNEqu();
+        int nTCells = grid->nCells + grid->nBFaces;
+        for ( int cId = 0; cId < nTCells; ++ cId )
+        {
+            for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+            {
+                dq( iEqu, cId ) = InterfaceDqValue( zId, cId, iEqu );
+            }
+        }
+
+        InterFace * interFace = grid->interFace;
+        if ( ! ONEFLOW::IsValid( interFace ) ) continue;
+
+        for ( int ghostId = 0; ghostId < MAX_GHOST_LEVELS; ++ ghostId )
+        {
+            ONEFLOW::GetFieldPointer( interFace->dataSend[ ghostId ], dqHandle );
+            ONEFLOW::GetFieldPointer( interFace->dataRecv[ ghostId ], dqHandle );
+            ONEFLOW::GetFieldPointer( interFace->dataSend[ ghostId ], qHandle );
+        }
+
+        ONEFLOW::UploadInterfaceValue( grid, & dq, "dq", nEqu );
+    }
+}
+
+void InterfaceDqTest::ExchangeDq()
+{
+    Task task;
+    task.taskId     = 0;
+    task.taskName   = "IFACE_DQ_TEST";
+    task.action     = 0;
+    task.sendAction = & SendInterfaceDq;
+    task.recvAction = & RecvInterfaceDq;
+
+    InterfaceExchange * exchange = new InterfaceExchange( & task );
+    exchange->Start();
+    exchange->Finish();
+    delete exchange;
+
+    FieldHandle< MCField > dqHandle( "dq" );
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        MCField & dq = ONEFLOW::GetFieldReference( grid, dqHandle );
+        ONEFLOW::DownloadInterfaceValue( grid, & dq, "dq", dq.GetNEqu() );
+    }
+}
+
+void InterfaceDqTest::CheckGhostDq()
+{
+    FieldHandle< MCField > dqHandle( "dq" );
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        InterFace * interFace = grid->interFace;
+        if ( ! ONEFLOW::IsValid( interFace ) ) continue;
+
+        MCField & dq = ONEFLOW::GetFieldReference( grid, dqHandle );
+        int nEqu = dq.GetNEqu();
+
+        for ( int iFace = 0; iFace < interFace->nIFaces; ++ iFace )
+        {
+            int tId;
+            grid->faceTopo->GetTId( iFace, 1, tId );
+
+            //localCellId is not kept in the grid file, the donor is the interior cell of the matching face
+            int neiZone = interFace->zoneId[ iFace ];
+            int donorCell;
+            if ( ZoneState::IsValidZone( neiZone ) )
+            {
+                UnsGrid * neiGrid = UnsGridCast( Zone::GetGrid( neiZone ) );
+                neiGrid->faceTopo->GetSId( interFace->localInterfaceId[ iFace ], 1, donorCell );
+            }
+            else
+            {
+                //remote donor: take the cell from the first equation, the zone and the other equations must still match
+                donorCell = static_cast< int >( ( dq( 0, tId ) - InterfaceDqValue( neiZone, 0, 0 ) ) / 10.0 + 0.5 );
+            }
+
+            for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+            {
+                Real donor = InterfaceDqValue( neiZone, donorCell, iEqu );
+                if ( dq( iEqu, tId ) != donor )
+                {
+                    std::cout << " zone = " << zId << " interface face = " << iFace << " iEqu = " << iEqu;
+                    std::cout << " ghost = " << dq( iEqu, tId ) << " donor = " << donor << "\n";
+                    Stop( "iface_dq: the exchanged dq differs from the donor cell\n" );
+                }
+            }
+            ++ nCheckFaces;
+        }
+    }
+}
+
+EndNameSpace
@@ -0,0 +1,169 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "InvBatchTest.h"
+#include "NsInvFluxImp.h"
+#include "NsCom.h"
+#include "NsIdx.h"
+#include "Com.h"
+#include "Ctrl.h"
+#include "HXMath.h"
+#include "Stop.h"
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+InvBatchTest::InvBatchTest()
+{
+    nFaces = 4099;
+    //-Ofast reassociates and contracts, so the two paths only agree to rounding
+    tolerance = 1.0e-10;
+    seed = 12345;
+}
+
+InvBatchTest::~InvBatchTest()
+{
+    ;
+}
+
+Real InvBatchTest::Random( Real a, Real b )
+{
+    seed = seed * 1103515245u + 12345u;
+    Real r = static_cast< Real >( ( seed >> 8 ) & 0xFFFFFF ) / static_cast< Real >( 0xFFFFFF );
+    return a + ( b - a ) * r;
+}
+
+void InvBatchTest::SetRandomFace( NsInvBatch & batch, int i )
+{
+    Real nx = this->Random( - 1.0, 1.0 );
+    Real ny = this->Random( - 1.0, 1.0 );
+    Real nz = this->Random( - 1.0, 1.0 );
+    Real nn = sqrt( SQR( nx, ny, nz ) ) + SMALL;
+
+    batch.xfn[ i ] = nx / nn;
+    batch.yfn[ i ] = ny / nn;
+    batch.zfn[ i ] = nz / nn;
+    batch.vfn[ i ] = this->Random( - 0.1, 0.1 );
+    batch.gama1[ i ] = this->Random( 1.3, 1.4 );
+    batch.gama2[ i ] = this->Random( 1.3, 1.4 );
+
+    //subsonic and supersonic states on both sides
+    batch.prim1[ IDX::IR ][ i ] = this->Random( 0.2, 2.0 );
+    batch.prim1[ IDX::IU ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim1[ IDX::IV ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim1[ IDX::IW ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim1[ IDX::IP ][ i ] = this->Random( 0.2, 2.0 );
+
+    batch.prim2[ IDX::IR ][ i ] = this->Random( 0.2, 2.0 );
+    batch.prim2[ IDX::IU ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim2[ IDX::IV ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim2[ IDX::IW ][ i ] = this->Random( - 2.0, 2.0 );
+    batch.prim2[ IDX::IP ][ i ] = this->Random( 0.2, 2.0 );
+}
+
+bool InvBatchTest::Compare( const std::string & name, InvFluxBatchPointer batchScheme, ScalarPointer scalarScheme )
+{
+    NsInvFlux nsInvFlux;
+    NsInv faceInv;
+    GCom faceGeom;
+    NsInvBatch batch;
+    faceInv.Init();
+
+    Real maxdiff = 0.0;
+    int nBatches = ( nFaces + NS_BATCH - 1 ) / NS_BATCH;
+    for ( int iBatch = 0; iBatch < nBatches; ++ iBatch )
+    {
+        batch.nFace = MIN( NS_BATCH, nFaces - iBatch * NS_BATCH );
+        for ( int i = 0; i < batch.nFace; ++ i )
+        {
+            batch.fId[ i ] = iBatch * NS_BATCH + i;
+            this->SetRandomFace( batch, i );
+        }
+        batch.FillEmptyLanes();
+
+        ( * batchScheme )( batch );
+
+        for ( int i = 0; i < batch.nFace; ++ i )
+        {
+            faceGeom.xfn = batch.xfn[ i ];
+            faceGeom.yfn = batch.yfn[ i ];
+            faceGeom.zfn = batch.zfn[ i ];
+            faceGeom.vfn = batch.vfn[ i ];
+            faceInv.gama1 = batch.gama1[ i ];
+            faceInv.gama2 = batch.gama2[ i ];
+            for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+            {
+                faceInv.prim1[ iEqu ] = batch.prim1[ iEqu ][ i ];
+                faceInv.prim2[ iEqu ] = batch.prim2[ iEqu ][ i ];
+            }
+
+            ( nsInvFlux.*scalarScheme )( faceInv, faceGeom );
+
+            for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+            {
+                Real diff = ABS( batch.flux[ iEqu ][ i ] - faceInv.flux[ iEqu ] );
+                Real scale = MAX( one, ABS( faceInv.flux[ iEqu ] ) );
+                maxdiff = MAX( maxdiff, diff / scale );
+            }
+        }
+    }
+
+    bool pass = ( maxdiff <= tolerance );
+    std::cout << " " << name << " ieigenfix = " << ctrl.ieigenfix << " max relative diff = " << maxdiff;
+    std::cout << ( pass ? " pass" : " FAIL" ) << "\n";
+    return pass;
+}
+
+void InvBatchTest::Run()
+{
+    int nBEqu = nscom.nBEqu;
+    int nEqu = nscom.nEqu;
+    int ieigenfix = ctrl.ieigenfix;
+    Real centropy1 = ctrl.centropy1;
+    Real centropy2 = ctrl.centropy2;
+
+    nscom.nBEqu = NS_BATCH_NEQU;
+    nscom.nEqu = NS_BATCH_NEQU;
+    ctrl.centropy1 = 0.01;
+    ctrl.centropy2 = 0.1;
+
+    bool pass = true;
+    for ( int fix = 0; fix <= 1; ++ fix )
+    {
+        ctrl.ieigenfix = fix;
+        pass = this->Compare( "RoeBatch", & RoeBatch, & NsInvFlux::Roe ) && pass;
+    }
+    pass = this->Compare( "Slau2Batch", & Slau2Batch, & NsInvFlux::Slau2 ) && pass;
+
+    nscom.nBEqu = nBEqu;
+    nscom.nEqu = nEqu;
+    ctrl.ieigenfix = ieigenfix;
+    ctrl.centropy1 = centropy1;
+    ctrl.centropy2 = centropy2;
+
+    if ( ! pass )
+    {
+        Stop( "batch inviscid flux differs from the scalar scheme\n" );
+    }
+}
+
+EndNameSpace
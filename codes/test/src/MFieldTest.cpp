@@ -0,0 +1,211 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "MFieldTest.h"
+#include "Stop.h"
+#include <cstdint>
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+MFieldTest::MFieldTest()
+{
+    nFail = 0;
+}
+
+MFieldTest::~MFieldTest()
+{
+    ;
+}
+
+void MFieldTest::FillField( MRField & field, int nEqu, int nCells )
+{
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        for ( int iCell = 0; iCell < nCells; ++ iCell )
+        {
+            field[ iEqu ][ iCell ] = 1000.0 * iEqu + iCell + 0.5;
+        }
+    }
+}
+
+void MFieldTest::Check( bool flag, const std::string & name, int nEqu, int nCells, int layout, int align )
+{
+    if ( flag ) return;
+    nFail += 1;
+    std::cout << " " << name << " FAIL nEqu = " << nEqu << " nCells = " << nCells;
+    std::cout << " layout = " << layout << " align = " << align << "\n";
+}
+
+void MFieldTest::CheckRoundTrip( int nEqu, int nCells, int layout, int align )
+{
+    MRField source( nEqu, nCells );
+    MRField target( nEqu, nCells );
+    this->FillField( source, nEqu, nCells );
+
+    MCField field( nEqu, nCells, layout, align );
+    field.CopyFrom( source );
+    field.CopyTo( target );
+
+    bool same = true;
+    bool rowView = true;
+    bool block = true;
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        MFieldRow< Real > row = field[ iEqu ];
+        for ( int iCell = 0; iCell < nCells; ++ iCell )
+        {
+            same = same && ( target[ iEqu ][ iCell ] == source[ iEqu ][ iCell ] );
+            rowView = rowView && ( row[ iCell ] == source[ iEqu ][ iCell ] );
+            if ( layout == FIELD_AOS )
+            {
+                block = block && ( field.GetCell( iCell )[ iEqu ] == source[ iEqu ][ iCell ] );
+            }
+            else
+            {
+                block = block && ( field.GetEqu( iEqu )[ iCell ] == source[ iEqu ][ iCell ] );
+            }
+        }
+    }
+
+    this->Check( same, "CopyFrom/CopyTo", nEqu, nCells, layout, align );
+    this->Check( rowView, "row view", nEqu, nCells, layout, align );
+    this->Check( block, "GetCell/GetEqu", nEqu, nCells, layout, align );
+}
+
+void MFieldTest::CheckSetLayout( int nEqu, int nCells, int align )
+{
+    MRField source( nEqu, nCells );
+    MRField target( nEqu, nCells );
+    this->FillField( source, nEqu, nCells );
+
+    MCField field( nEqu, nCells, FIELD_SOA, align );
+    field.CopyFrom( source );
+
+    field.SetLayout( FIELD_AOS );
+    bool aos = ( field.GetLayout() == FIELD_AOS );
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        for ( int iCell = 0; iCell < nCells; ++ iCell )
+        {
+            aos = aos && ( field.GetCell( iCell )[ iEqu ] == source[ iEqu ][ iCell ] );
+        }
+    }
+
+    field.SetLayout( FIELD_SOA );
+    field.CopyTo( target );
+    bool soa = ( field.GetLayout() == FIELD_SOA );
+    for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+    {
+        for ( int iCell = 0; iCell < nCells; ++ iCell )
+        {
+            soa = soa && ( target[ iEqu ][ iCell ] == source[ iEqu ][ iCell ] );
+        }
+    }
+
+    this->Check( aos, "SetLayout SOA->AOS", nEqu, nCells, FIELD_AOS, align );
+    this->Check( soa, "SetLayout AOS->SOA", nEqu, nCells, FIELD_SOA, align );
+}
+
+void MFieldTest::CheckPadding( int nEqu, int nCells, int layout, int align )
+{
+    MCField field( nEqu, nCells, layout, align );
+    int width = align / static_cast< int >( sizeof( Real ) );
+
+    std::uintptr_t address = reinterpret_cast< std::uintptr_t >( field.GetData() );
+    this->Check( address % align == 0, "aligned data", nEqu, nCells, layout, align );
+
+    int nTotal = 0;
+    if ( layout == FIELD_AOS )
+    {
+        this->Check( field.GetEquStride() == 1, "AOS equation stride", nEqu, nCells, layout, align );
+        this->Check( static_cast< int >( field.GetCellStride() ) == nEqu, "AOS cell stride", nEqu, nCells, layout, align );
+        nTotal = ( ( nEqu * nCells + width - 1 ) / width ) * width;
+    }
+    else
+    {
+        int eqStride = static_cast< int >( field.GetEquStride() );
+        bool padded = ( eqStride >= nCells ) && ( eqStride % width == 0 ) && ( eqStride - nCells < width );
+        this->Check( padded, "SOA padded equation stride", nEqu, nCells, layout, align );
+        this->Check( field.GetCellStride() == 1, "SOA cell stride", nEqu, nCells, layout, align );
+        for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+        {
+            std::uintptr_t rowAddress = reinterpret_cast< std::uintptr_t >( field.GetEqu( iEqu ) );
+            this->Check( rowAddress % align == 0, "aligned equation row", nEqu, nCells, layout, align );
+        }
+        nTotal = eqStride * nEqu;
+    }
+
+    //assigning a value also fills the padding, so whole blocks can be streamed
+    field = 2.5;
+    Real * data = field.GetData();
+    bool filled = true;
+    for ( int i = 0; i < nTotal; ++ i )
+    {
+        filled = filled && ( data[ i ] == 2.5 );
+    }
+    this->Check( filled, "fill with padding", nEqu, nCells, layout, align );
+
+    //the row view must not write into the padding
+    field = 0.0;
+    field[ nEqu - 1 ] = 1.0;
+    Real sum = 0.0;
+    for ( int i = 0; i < nTotal; ++ i )
+    {
+        sum += data[ i ];
+    }
+    this->Check( sum == nCells, "row view stays inside the row", nEqu, nCells, layout, align );
+}
+
+void MFieldTest::Run()
+{
+    int nEquList[] = { 1, 5, 7 };
+    int nCellsList[] = { 1, 7, 64, 1001 };
+    int alignList[] = { 8, 32, 64 };
+
+    for ( int i = 0; i < 3; ++ i )
+    {
+        for ( int j = 0; j < 4; ++ j )
+        {
+            for ( int k = 0; k < 3; ++ k )
+            {
+                int nEqu = nEquList[ i ];
+                int nCells = nCellsList[ j ];
+                int align = alignList[ k ];
+                this->CheckRoundTrip( nEqu, nCells, FIELD_SOA, align );
+                this->CheckRoundTrip( nEqu, nCells, FIELD_AOS, align );
+                this->CheckSetLayout( nEqu, nCells, align );
+                this->CheckPadding( nEqu, nCells, FIELD_SOA, align );
+                this->CheckPadding( nEqu, nCells, FIELD_AOS, align );
+            }
+        }
+    }
+
+    std::cout << " MFieldTest failures = " << nFail << "\n";
+
+    if ( nFail > 0 )
+    {
+        Stop( "MCField storage differs from MRField\n" );
+    }
+}
+
+EndNameSpace
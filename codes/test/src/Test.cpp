@@ -23,6 +23,13 @@ along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
 #include "FileIO.h"
 
 #include "Prj.h"
+#include "DataBase.h"
+#include "InvBatchTest.h"
+#include "WallDistTest.h"
+#include "MFieldTest.h"
+#include "InterfaceDqTest.h"
+#include "FusedFaceTest.h"
+#include "Stop.h"
 #include <iostream>
 #include <fstream>
 
@@ -100,10 +107,45 @@ Real Test::VencatEric( Real x )
 }
 
 
+//test_case selects the check run by simutask = "FunctionTest"
 void FunctionTest()
 {
-    Test test;
-    test.Run();
+    std::string testCase = ONEFLOW::GetDataValueOrDefault< std::string >( "test_case", "vencat" );
+
+    if ( testCase == "vencat" )
+    {
+        Test test;
+        test.Run();
+    }
+    else if ( testCase == "inv_batch" )
+    {
+        InvBatchTest invBatchTest;
+        invBatchTest.Run();
+    }
+    else if ( testCase == "wall_dist" )
+    {
+        WallDistTest wallDistTest;
+        wallDistTest.Run();
+    }
+    else if ( testCase == "mfield" )
+    {
+        MFieldTest mFieldTest;
+        mFieldTest.Run();
+    }
+    else if ( testCase == "iface_dq" )
+    {
+        InterfaceDqTest interfaceDqTest;
+        interfaceDqTest.Run();
+    }
+    else if ( testCase == "fused_face" )
+    {
+        FusedFaceTest fusedFaceTest;
+        fusedFaceTest.Run();
+    }
+    else
+    {
+        Stop( "unknown test_case " + testCase + "\n" );
+    }
 }
 
 
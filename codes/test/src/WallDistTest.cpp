@@ -0,0 +1,257 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "WallDistTest.h"
+#include "WallDist.h"
+#include "MultiBlock.h"
+#include "System.h"
+#include "CmxTask.h"
+#include "SolverDef.h"
+#include "SolverState.h"
+#include "Parallel.h"
+#include "Zone.h"
+#include "ZoneState.h"
+#include "UnsGrid.h"
+#include "CellMesh.h"
+#include "NodeMesh.h"
+#include "FaceTopo.h"
+#include "BcRecord.h"
+#include "Boundary.h"
+#include "Dimension.h"
+#include "Constant.h"
+#include "HXMath.h"
+#include "Stop.h"
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+WallDistTest::WallDistTest()
+{
+    nCheckCells = 0;
+    nTieCells = 0;
+}
+
+WallDistTest::~WallDistTest()
+{
+    ;
+}
+
+void WallDistTest::Run()
+{
+    //the grid and its boundary conditions come from gridFileName of the case, e.g. test/turbplateuns2droe_sa
+    ConstructSystemMap();
+    MultiBlock::LoadGridAndBuildLink();
+    MultiBlock::AllocWallDist();
+
+    SolverState::tid = GRID_SOLVER;
+    SsSgTask( "FILL_WALL_STRUCT" );
+    SsSgTask( "CALC_WALL_DIST" );
+
+    this->CheckExhaustive();
+
+    this->CheckMovedWall();
+
+    FreeWallStruct();
+
+    std::cout << " wall_dist: pid = " << Parallel::pid << " nCells = " << nCheckCells;
+    std::cout << " equidistant nearest faces = " << nTieCells << " passed\n";
+}
+
+void WallDistTest::CheckMovedWall()
+{
+    //the wall moves by a tenth of the smallest wall distance, so no cell is inverted
+    Real minDist = LARGE;
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        RealField & dist = grid->cellMesh->dist;
+        for ( int cId = 0; cId < grid->nCells; ++ cId )
+        {
+            minDist = MIN( minDist, dist[ cId ] );
+        }
+    }
+    Real gminDist = minDist;
+    HXReduceReal( & minDist, & gminDist, 1, PL_MIN );
+
+    //one wave over the extent of the wall, the same on every rank since every rank holds the whole wall
+    Real cmin = LARGE, cmax = - LARGE;
+    for ( int iWFace = 0; iWFace < static_cast<int>( wallstruct->fc.size() ); ++ iWFace )
+    {
+        WallStructure::PointType & fc = wallstruct->fc[ iWFace ];
+        cmin = MIN( cmin, MIN( fc.x, MIN( fc.y, fc.z ) ) );
+        cmax = MAX( cmax, MAX( fc.x, MAX( fc.y, fc.z ) ) );
+    }
+    Real waveNumber = 2.0 * PI / MAX( cmax - cmin, SMALL );
+
+    this->MoveWall( 0.1 * gminDist, waveNumber );
+
+    SolverState::tid = GRID_SOLVER;
+    SsSgTask( "CALC_METRICS" );
+
+    //incremental: the tree is refitted and each cell starts from its last nearest face
+    UpdateWallDist();
+
+    LinkField nearFaceUpdate = wallFaceIds;
+    HXVector< RealField > distUpdate( ZoneState::nZones );
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        distUpdate[ zId ] = Zone::GetUnsGrid()->cellMesh->dist;
+    }
+
+    //full: a new tree and no starting faces
+    FreeWallStruct();
+    SsSgTask( "FILL_WALL_STRUCT" );
+    SsSgTask( "CALC_WALL_DIST" );
+
+    int nCells = 0;
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        RealField & dist = grid->cellMesh->dist;
+
+        for ( int cId = 0; cId < grid->nCells; ++ cId )
+        {
+            if ( distUpdate[ zId ][ cId ] != dist[ cId ] )
+            {
+                std::cout << " zone = " << zId << " cell = " << cId;
+                std::cout << " updated = " << distUpdate[ zId ][ cId ] << " full = " << dist[ cId ] << "\n";
+                Stop( "wall_dist: the incremental distance of the moved wall differs from the full search\n" );
+            }
+            ++ nCells;
+        }
+    }
+
+    std::cout << " wall_dist: moved wall by " << 0.1 * gminDist << ", " << nCells << " incremental distances match the full search\n";
+}
+
+void WallDistTest::MoveWall( Real amplitude, Real waveNumber )
+{
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+        BcRecord * bcRecord = grid->faceTopo->bcManager->bcRecord;
+        int nBFaces = bcRecord->GetNBFace();
+
+        RealField & x = grid->nodeMesh->xN;
+        RealField & y = grid->nodeMesh->yN;
+        RealField & z = grid->nodeMesh->zN;
+
+        IntField moved( grid->nNodes, 0 );
+
+        for ( int iFace = 0; iFace < nBFaces; ++ iFace )
+        {
+            if ( bcRecord->bcType[ iFace ] != BC::SOLID_SURFACE ) continue;
+
+            int nNodes = grid->faceTopo->faces[ iFace ].size();
+            for ( int iNode = 0; iNode < nNodes; ++ iNode )
+            {
+                int iPoint = grid->faceTopo->faces[ iFace ][ iNode ];
+                if ( moved[ iPoint ] ) continue;
+                moved[ iPoint ] = 1;
+
+                //a function of the old position, so a node shared by two zones moves the same way in both
+                Real x0 = x[ iPoint ];
+                Real y0 = y[ iPoint ];
+                Real z0 = z[ iPoint ];
+                x[ iPoint ] += amplitude * sin( waveNumber * ( y0 + z0 ) );
+                y[ iPoint ] += amplitude * sin( waveNumber * ( x0 + z0 ) );
+                if ( ONEFLOW::IsThreeD() )
+                {
+                    z[ iPoint ] += amplitude * sin( waveNumber * ( x0 + y0 ) );
+                }
+            }
+        }
+    }
+}
+
+void WallDistTest::CheckExhaustive()
+{
+    int nWFace = wallstruct->fv.size();
+
+    for ( int zId = 0; zId < ZoneState::nZones; ++ zId )
+    {
+        if ( ! ZoneState::IsValidZone( zId ) ) continue;
+
+        ZoneState::zid = zId;
+        UnsGrid * grid = Zone::GetUnsGrid();
+
+        RealField & dist = grid->cellMesh->dist;
+        RealField & xcc = grid->cellMesh->xcc;
+        RealField & ycc = grid->cellMesh->ycc;
+        RealField & zcc = grid->cellMesh->zcc;
+        IntField & nearFace = wallFaceIds[ zId ];
+
+        for ( int cId = 0; cId < grid->nCells; ++ cId )
+        {
+            WallStructure::PointType ccp( xcc[ cId ], ycc[ cId ], zcc[ cId ] );
+
+            Real minDist = LARGE;
+            int minFace = -1;
+            for ( int iWFace = 0; iWFace < nWFace; ++ iWFace )
+            {
+                Real wdst = CalcPoint2FaceDist( ccp, wallstruct->fv[ iWFace ] );
+                if ( minDist > wdst )
+                {
+                    minDist = wdst;
+                    minFace = iWFace;
+                }
+            }
+
+            //the tree evaluates the same face distances, so the result must be identical, not just close
+            if ( dist[ cId ] != sqrt( minDist ) )
+            {
+                std::cout << " zone = " << zId << " cell = " << cId;
+                std::cout << " dist = " << dist[ cId ] << " exhaustive = " << sqrt( minDist ) << "\n";
+                Stop( "wall_dist: the distance differs from the exhaustive search\n" );
+            }
+
+            int wallFaceId = nearFace[ cId ];
+            if ( wallFaceId != minFace )
+            {
+                //another face is only accepted when it is exactly as near, e.g. two faces sharing the nearest edge
+                if ( wallFaceId < 0 || wallFaceId >= nWFace ||
+                     CalcPoint2FaceDist( ccp, wallstruct->fv[ wallFaceId ] ) != minDist )
+                {
+                    std::cout << " zone = " << zId << " cell = " << cId;
+                    std::cout << " nearest face = " << wallFaceId << " exhaustive = " << minFace << "\n";
+                    Stop( "wall_dist: the nearest wall face differs from the exhaustive search\n" );
+                }
+                ++ nTieCells;
+            }
+            ++ nCheckCells;
+        }
+    }
+}
+
+EndNameSpace
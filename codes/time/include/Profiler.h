@@ -0,0 +1,116 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "Configure.h"
+#include "HXType.h"
+#include "HXVector.h"
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+
+BeginNameSpace( ONEFLOW )
+
+class ProfileNode
+{
+public:
+    ProfileNode();
+    ~ProfileNode();
+public:
+    std::string name;
+    int parent;
+    std::map< std::string, int > children;
+    long long calls;
+    double time;
+    double wait;
+};
+
+class ProfileEvent
+{
+public:
+    int node;
+    double start, span;
+};
+
+//nested wall-clock timers, switched on by profile = 1 (tables) or 2 (tables and timeline)
+class Profiler
+{
+public:
+    Profiler();
+    ~Profiler();
+public:
+    static bool enabled;
+    static bool trace;
+    static int maxEvents;
+    static std::string fileName;
+    static HXVector< ProfileNode > nodes;
+    static HXVector< int > stack;
+    static HXVector< double > startTime;
+    static HXVector< ProfileEvent > events;
+public:
+    static void Init();
+    static double WallTime();
+    static void Start( const std::string & name );
+    static void Finish();
+    static void AddWait( double span );
+    static void Report();
+protected:
+    static std::string GetPath( int id );
+    static void WriteRank( std::fstream & file );
+    static void WriteSummary( std::fstream & file, std::string & rankTable );
+    static void WriteTrace( std::fstream & file );
+};
+
+class ProfileScope
+{
+public:
+    ProfileScope( const std::string & name )
+    {
+        if ( Profiler::enabled ) Profiler::Start( name );
+        on = Profiler::enabled;
+    }
+    ~ProfileScope()
+    {
+        if ( on ) Profiler::Finish();
+    }
+protected:
+    bool on;
+};
+
+//time spent blocked in message passing, charged to the open timer
+class ProfileWaitScope
+{
+public:
+    ProfileWaitScope()
+    {
+        t0 = Profiler::enabled ? Profiler::WallTime() : 0.0;
+    }
+    ~ProfileWaitScope()
+    {
+        if ( Profiler::enabled ) Profiler::AddWait( Profiler::WallTime() - t0 );
+    }
+protected:
+    double t0;
+};
+
+EndNameSpace
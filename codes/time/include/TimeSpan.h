@@ -22,7 +22,7 @@ License
 #pragma once
 #include "Configure.h"
 #include <string>
-#include <ctime>
+#include <chrono>
 
 
 BeginNameSpace( ONEFLOW )
@@ -33,7 +33,7 @@ public:
     TimeSpan();
     ~TimeSpan();
 public:
-    clock_t t_old, t;
+    std::chrono::steady_clock::time_point t_old, t;
 public:
     void ResetTime();
     void ShowTimeSpan( const std::string & title = "" );
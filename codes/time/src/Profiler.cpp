@@ -0,0 +1,332 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "Profiler.h"
+#include "DataBase.h"
+#include "Parallel.h"
+#include "Prj.h"
+#include "HXMath.h"
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+BeginNameSpace( ONEFLOW )
+
+ProfileNode::ProfileNode()
+{
+    parent = - 1;
+    calls = 0;
+    time = 0.0;
+    wait = 0.0;
+}
+
+ProfileNode::~ProfileNode()
+{
+    ;
+}
+
+bool Profiler::enabled = false;
+bool Profiler::trace = false;
+int Profiler::maxEvents = 1000000;
+std::string Profiler::fileName = "results/profile";
+HXVector< ProfileNode > Profiler::nodes;
+HXVector< int > Profiler::stack;
+HXVector< double > Profiler::startTime;
+HXVector< ProfileEvent > Profiler::events;
+
+Profiler::Profiler()
+{
+    ;
+}
+
+Profiler::~Profiler()
+{
+    ;
+}
+
+void Profiler::Init()
+{
+    int profile = ONEFLOW::GetDataValueOrDefault< int >( "profile", 0 );
+    Profiler::maxEvents = ONEFLOW::GetDataValueOrDefault< int >( "profile_max_events", 1000000 );
+    Profiler::fileName = ONEFLOW::GetDataValueOrDefault< std::string >( "profile_file", "results/profile" );
+
+    Profiler::enabled = ( profile > 0 );
+    Profiler::trace = ( profile > 1 );
+
+    if ( ! Profiler::enabled ) return;
+
+    //the root timer spans the whole run and is closed by Report
+    Profiler::nodes.resize( 1 );
+    Profiler::nodes[ 0 ].name = "total";
+    Profiler::nodes[ 0 ].calls = 1;
+    Profiler::stack.resize( 0 );
+    Profiler::stack.push_back( 0 );
+    Profiler::startTime.resize( 0 );
+    Profiler::startTime.push_back( Profiler::WallTime() );
+}
+
+double Profiler::WallTime()
+{
+    static std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    std::chrono::duration< double > span = std::chrono::steady_clock::now() - t0;
+    return span.count();
+}
+
+void Profiler::Start( const std::string & name )
+{
+    int cur = Profiler::stack.back();
+    std::map< std::string, int > & children = Profiler::nodes[ cur ].children;
+    std::map< std::string, int >::iterator iter = children.find( name );
+
+    int id = 0;
+    if ( iter == children.end() )
+    {
+        id = Profiler::nodes.size();
+        children[ name ] = id;
+        Profiler::nodes.push_back( ProfileNode() );
+        Profiler::nodes[ id ].name = name;
+        Profiler::nodes[ id ].parent = cur;
+    }
+    else
+    {
+        id = iter->second;
+    }
+
+    Profiler::stack.push_back( id );
+    Profiler::startTime.push_back( Profiler::WallTime() );
+}
+
+void Profiler::Finish()
+{
+    if ( Profiler::stack.size() <= 1 ) return;
+
+    int id = Profiler::stack.back();
+    double t0 = Profiler::startTime.back();
+    double span = Profiler::WallTime() - t0;
+    Profiler::stack.pop_back();
+    Profiler::startTime.pop_back();
+
+    ProfileNode & node = Profiler::nodes[ id ];
+    node.calls += 1;
+    node.time += span;
+
+    if ( Profiler::trace && static_cast< int >( Profiler::events.size() ) < Profiler::maxEvents )
+    {
+        ProfileEvent event;
+        event.node = id;
+        event.start = t0;
+        event.span = span;
+        Profiler::events.push_back( event );
+    }
+}
+
+void Profiler::AddWait( double span )
+{
+    if ( Profiler::stack.empty() ) return;
+    Profiler::nodes[ Profiler::stack.back() ].wait += span;
+}
+
+std::string Profiler::GetPath( int id )
+{
+    std::string path = Profiler::nodes[ id ].name;
+    int parent = Profiler::nodes[ id ].parent;
+    while ( parent >= 0 )
+    {
+        path = Profiler::nodes[ parent ].name + "/" + path;
+        parent = Profiler::nodes[ parent ].parent;
+    }
+    return path;
+}
+
+void Profiler::Report()
+{
+    if ( ! Profiler::enabled ) return;
+
+    while ( Profiler::stack.size() > 1 )
+    {
+        Profiler::Finish();
+    }
+    Profiler::nodes[ 0 ].time = Profiler::WallTime() - Profiler::startTime[ 0 ];
+
+    std::ostringstream oss;
+    oss << Profiler::fileName << "_" << Parallel::GetPid();
+    std::string rankName = oss.str();
+
+    std::fstream file;
+    Prj::OpenPrjFile( file, rankName + ".txt", std::ios_base::out );
+    Profiler::WriteRank( file );
+    Prj::CloseFile( file );
+
+    if ( Profiler::trace )
+    {
+        Prj::OpenPrjFile( file, rankName + ".json", std::ios_base::out );
+        Profiler::WriteTrace( file );
+        Prj::CloseFile( file );
+    }
+
+    //every rank sends "path calls time wait" lines to the server
+    std::ostringstream table;
+    table << std::setprecision( 12 );
+    for ( HXSize_t id = 0; id < Profiler::nodes.size(); ++ id )
+    {
+        ProfileNode & node = Profiler::nodes[ id ];
+        table << Profiler::GetPath( id ) << " " << node.calls << " " << node.time << " " << node.wait << "\n";
+    }
+    std::string rankTable = table.str();
+
+    if ( Parallel::IsServer() )
+    {
+        Prj::OpenPrjFile( file, Profiler::fileName + "_summary.txt", std::ios_base::out );
+        Profiler::WriteSummary( file, rankTable );
+        Prj::CloseFile( file );
+    }
+    else
+    {
+        ONEFLOW::HXSendString( rankTable, Parallel::GetServerid(), Parallel::GetDefaultTag() );
+    }
+}
+
+void Profiler::WriteRank( std::fstream & file )
+{
+    double total = Profiler::nodes[ 0 ].time;
+    if ( total <= 0.0 ) total = 1.0;
+
+    file << "rank " << Parallel::GetPid() << "\n";
+    file << std::setw( 12 ) << "calls" << std::setw( 14 ) << "time(s)" << std::setw( 14 ) << "self(s)";
+    file << std::setw( 14 ) << "wait(s)" << std::setw( 9 ) << "%" << "  timer\n";
+
+    for ( HXSize_t id = 0; id < Profiler::nodes.size(); ++ id )
+    {
+        ProfileNode & node = Profiler::nodes[ id ];
+
+        double self = node.time;
+        std::map< std::string, int >::iterator iter;
+        for ( iter = node.children.begin(); iter != node.children.end(); ++ iter )
+        {
+            self -= Profiler::nodes[ iter->second ].time;
+        }
+
+        int depth = 0;
+        for ( int p = node.parent; p >= 0; p = Profiler::nodes[ p ].parent )
+        {
+            ++ depth;
+        }
+
+        file << std::setw( 12 ) << node.calls;
+        file << std::setw( 14 ) << std::fixed << std::setprecision( 6 ) << node.time;
+        file << std::setw( 14 ) << self;
+        file << std::setw( 14 ) << node.wait;
+        file << std::setw( 9 ) << std::setprecision( 2 ) << 100.0 * node.time / total;
+        file << "  " << std::string( 2 * depth, ' ' ) << node.name << "\n";
+    }
+}
+
+void Profiler::WriteSummary( std::fstream & file, std::string & rankTable )
+{
+    HXVector< std::string > pathList;
+    std::map< std::string, int > pathMap;
+    HXVector< HXVector< double > > stat;
+    HXVector< int > nRank;
+
+    int nProc = Parallel::GetNProc();
+    for ( int pid = 0; pid < nProc; ++ pid )
+    {
+        std::string cs = rankTable;
+        if ( pid != Parallel::GetServerid() )
+        {
+            ONEFLOW::HXRecvString( cs, pid, Parallel::GetDefaultTag() );
+        }
+
+        std::istringstream iss( cs );
+        std::string path;
+        long long calls = 0;
+        double time = 0.0, wait = 0.0;
+        while ( iss >> path >> calls >> time >> wait )
+        {
+            std::map< std::string, int >::iterator iter = pathMap.find( path );
+            int id = 0;
+            if ( iter == pathMap.end() )
+            {
+                id = pathList.size();
+                pathMap[ path ] = id;
+                pathList.push_back( path );
+                //calls, min, sum, max of the time, sum of the wait
+                HXVector< double > s( 5, 0.0 );
+                s[ 1 ] = time;
+                s[ 3 ] = time;
+                stat.push_back( s );
+                nRank.push_back( 0 );
+            }
+            else
+            {
+                id = iter->second;
+            }
+
+            HXVector< double > & s = stat[ id ];
+            s[ 0 ] += calls;
+            s[ 1 ] = MIN( s[ 1 ], time );
+            s[ 2 ] += time;
+            s[ 3 ] = MAX( s[ 3 ], time );
+            s[ 4 ] += wait;
+            nRank[ id ] += 1;
+        }
+    }
+
+    file << "ranks " << nProc << "\n";
+    file << std::setw( 12 ) << "calls" << std::setw( 14 ) << "min(s)" << std::setw( 14 ) << "avg(s)";
+    file << std::setw( 14 ) << "max(s)" << std::setw( 14 ) << "avg wait(s)" << "  timer\n";
+
+    for ( HXSize_t id = 0; id < pathList.size(); ++ id )
+    {
+        HXVector< double > & s = stat[ id ];
+        //a timer missing on some rank counts as zero there
+        if ( nRank[ id ] < nProc ) s[ 1 ] = 0.0;
+
+        file << std::setw( 12 ) << static_cast< long long >( s[ 0 ] );
+        file << std::setw( 14 ) << std::fixed << std::setprecision( 6 ) << s[ 1 ];
+        file << std::setw( 14 ) << s[ 2 ] / nProc;
+        file << std::setw( 14 ) << s[ 3 ];
+        file << std::setw( 14 ) << s[ 4 ] / nProc;
+        file << "  " << pathList[ id ] << "\n";
+    }
+}
+
+//chrome://tracing and Perfetto read the complete ("X") events directly
+void Profiler::WriteTrace( std::fstream & file )
+{
+    int pid = Parallel::GetPid();
+    file << "{\"traceEvents\":[\n";
+    for ( HXSize_t i = 0; i < Profiler::events.size(); ++ i )
+    {
+        ProfileEvent & event = Profiler::events[ i ];
+        file << "{\"name\":\"" << Profiler::nodes[ event.node ].name << "\",\"ph\":\"X\"";
+        file << ",\"ts\":" << std::fixed << std::setprecision( 3 ) << event.start * 1.0e6;
+        file << ",\"dur\":" << event.span * 1.0e6;
+        file << ",\"pid\":" << pid << ",\"tid\":0}";
+        if ( i + 1 < Profiler::events.size() ) file << ",";
+        file << "\n";
+    }
+    file << "]}\n";
+}
+
+EndNameSpace
@@ -39,15 +39,15 @@ TimeSpan::~TimeSpan()
 
 void TimeSpan::ShowTimeSpan( const std::string & title )
 {
-    t = clock();
-    clock_t timeSpan = t - t_old;
+    t = std::chrono::steady_clock::now();
+    std::chrono::duration< Real > timeSpan = t - t_old;
     t_old = t;
-    std::cout << title << " Time elapsed : " << static_cast< Real >( timeSpan ) / CLOCKS_PER_SEC << " seconds" << "\n";
+    std::cout << title << " Time elapsed : " << timeSpan.count() << " seconds" << "\n";
 }
 
 void TimeSpan::ResetTime()
 {
-    t_old = clock();
+    t_old = std::chrono::steady_clock::now();
     t = t_old;
 }
 
@@ -23,6 +23,7 @@ License
 
 #pragma once
 #include "NsCom.h"
+#include "FieldHandle.h"
 
 BeginNameSpace( ONEFLOW )
 
@@ -37,7 +38,7 @@ public:
     void Init();
 public:
     MRField * q, * q1, * q2;
-    MRField * dq;
+    MCField * dq;
     MRField * rhs, * drhs;
     MRField * gama, * gama1, * gama2;
     MRField * dqdx, * dqdy, * dqdz;
@@ -62,4 +63,41 @@ public:
 
 extern UNsField unsf;
 
+//slots of the flow fields, resolved once instead of by name on every grid switch
+class UNsFieldHandle
+{
+public:
+    UNsFieldHandle();
+    ~UNsFieldHandle();
+public:
+    FieldHandle< MRField > q;
+    FieldHandle< MRField > q1;
+    FieldHandle< MRField > q2;
+    FieldHandle< MCField > dq;
+    FieldHandle< MRField > limiter;
+    FieldHandle< MRField > gama;
+    FieldHandle< MRField > dqdx;
+    FieldHandle< MRField > dqdy;
+    FieldHandle< MRField > dqdz;
+    FieldHandle< MRField > dtdx;
+    FieldHandle< MRField > dtdy;
+    FieldHandle< MRField > dtdz;
+    FieldHandle< MRField > bc_q;
+    FieldHandle< MRField > bcdqdx;
+    FieldHandle< MRField > bcdqdy;
+    FieldHandle< MRField > bcdqdz;
+    FieldHandle< MRField > visl;
+    FieldHandle< MRField > vist;
+    FieldHandle< MRField > tempr;
+    FieldHandle< MRField > timestep;
+    FieldHandle< MRField > invsr;
+    FieldHandle< MRField > vissr;
+    FieldHandle< MRField > impsr;
+    FieldHandle< MRField > res;
+    FieldHandle< MRField > res1;
+    FieldHandle< MRField > res2;
+};
+
+extern UNsFieldHandle unsh;
+
 EndNameSpace
@@ -23,18 +23,33 @@ License
 
 #pragma once
 #include "NsInvFlux.h"
+#include "NsInvBatch.h"
 
 BeginNameSpace( ONEFLOW )
 
 class UNsFField;
 class Limiter;
 class LimField;
+class GCom;
 
 class UNsInvFlux : public NsInvFlux
 {
 public:
     UNsInvFlux ();
     ~UNsInvFlux();
+public:
+    //face loops instantiated for every scheme, the scheme is picked once per zone
+    typedef void ( UNsInvFlux:: * FaceLoopPointer )();
+    FaceLoopPointer faceLoopPointer;
+    void SetFaceLoop( int schemeIndex );
+    template < NsInvFlux::InvFluxPointer scheme >
+    void CalcInvFluxLoop();
+    template < NsInvFlux::InvFluxPointer scheme >
+    void CalcFaceInvFlux( int fId, NsInv & inv, GCom & gcom );
+    template < InvFluxBatchPointer scheme >
+    void CalcInvFluxBatchLoop();
+    template < InvFluxBatchPointer scheme >
+    void CalcBatchInvFlux( NsInvBatch & batch, NsInv & inv, GCom & gcom );
 public:
     void Alloc();
     void DeAlloc();
@@ -43,8 +58,8 @@ public:
     void CalcInvFace();
     void CalcLimiter();
     void AddInvFlux();
-    void PrepareFaceValue();
-    void UpdateFaceInvFlux();
+    void PrepareFaceValue( int fId, NsInv & inv, GCom & gcom );
+    void UpdateFaceInvFlux( int fId, NsInv & inv, GCom & gcom );
     void ReadTmp();
 public:
     void GetQlQrField();
@@ -54,6 +69,7 @@ public:
     Limiter * limiter;
     LimField * limf;
     MRField * invflux;
+    MRField * res;
 };
 
 EndNameSpace
@@ -33,6 +33,7 @@ public:
 public:
     void Init() override;
     void BcQlQrFix() override;
+    bool BcQlQrFix( int fId, int lc, int rc, RealField & ql, RealField & qr ) override;
 };
 
 class NsLimiter : public Limiter
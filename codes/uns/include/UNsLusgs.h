@@ -25,6 +25,24 @@ License
 #include "NsLusgs.h"
 BeginNameSpace( ONEFLOW )
 
+//implicit operator of one zone, it only changes when the flow field is updated
+class UNsLusgsOperator
+{
+public:
+    UNsLusgsOperator();
+    ~UNsLusgsOperator();
+public:
+    bool spectrumValid;
+    bool lowerValid;
+    bool upperValid;
+    //face spectral radii seen from the cell solving the face in the lower and upper sweeps
+    RealField lowerRadius, upperRadius;
+    RealField lowerVisRad, upperVisRad;
+public:
+    void Init( int nFaces );
+    void Reset();
+};
+
 class UNsLusgs : public NsLusgs
 {
 public:
@@ -33,25 +51,40 @@ public:
 public:
     void LowerSweep() override;
     void UpperSweep() override;
+    void ResetOperator() override;
     void SingleSweep();
-    void PrepareSweep();
-    void Update();
-
-    void SolveLowerCell();
-    void SolveUpperCell();
-
-    void SolveLower( int fId );
-    void SolveUpper( int fId );
-
-    bool CanNotLowerSolve( int fId );
-    bool CanNotUpperSolve( int fId );
-    void Solve( int fId, int signValue );
-    void SetMeshGeometry();
-    void PrepareData();
-    void PrepareDataFacePrim();
-    void CalcViscousTerm();
+    void LowerSweepLevel();
+    void UpperSweepLevel();
+    void SweepLowerCell( LusgsData & nslu, int cId );
+    void SweepUpperCell( LusgsData & nslu, int cId );
+    void PrepareSweep( LusgsData & nslu );
+    void Update( LusgsData & nslu );
+
+    void SolveLowerCell( LusgsData & nslu );
+    void SolveUpperCell( LusgsData & nslu );
+
+    void SolveLower( LusgsData & nslu, int fId );
+    void SolveUpper( LusgsData & nslu, int fId );
+
+    bool CanNotLowerSolve( LusgsData & nslu, int fId );
+    bool CanNotUpperSolve( LusgsData & nslu, int fId );
+    void Solve( LusgsData & nslu, int fId, int signValue );
+    void SetMeshGeometry( LusgsData & nslu );
+    void PrepareData( LusgsData & nslu );
+    void PrepareDataFace( LusgsData & nslu );
+    void PrepareDataFacePrim( LusgsData & nslu );
+    void CalcFaceRadius( LusgsData & nslu );
+    void CalcViscousRadius( LusgsData & nslu );
     void Init();
     void CalcSpectrum();
+    void SetFaceOperator( int signOfSweep );
+    UNsLusgsOperator * GetOperator();
+public:
+    HXVector< HXVector< UNsLusgsOperator * > > operators;
+    UNsLusgsOperator * lusgsOperator;
+    RealField * faceRadius;
+    RealField * faceVisRad;
+    bool faceValid;
 };
 
 EndNameSpace
@@ -33,40 +33,44 @@ public:
     UNsVisFlux ();
     ~UNsVisFlux();
 public:
-    typedef void ( UNsVisFlux:: * VisPointer )();
+    typedef void ( UNsVisFlux:: * VisPointer )( NsVisFace & face );
     VisPointer visPointer;
     MRField * visflux;
+    MRField * res;
+    RealField bcHeatFlux;
 public:
     void SetVisPointer();
     void CalcFlux();
     void PrepareField();
     void CalcVisFlux();
+    void CalcFaceVisFlux( int fId, NsVisFace & face );
     void AddVisFlux();
-    void CalcFaceVisFlux();
-    void UpdateFaceVisFlux();
-    void CalcHeatFlux();
-    void CalcStress();
-    void CalcAniStress();
-    void CalcNsVisFlux();
-    void ZeroHeatFlux();
-    void AddChemHeatFlux();
-    void AddHeatFlux();
-    void SaveHeatFlux();
+    void CalcFaceVisFlux( NsVisFace & face );
+    void UpdateFaceVisFlux( NsVisFace & face );
+    void CalcHeatFlux( NsVisFace & face );
+    void CalcStress( NsVisFace & face );
+    void CalcAniStress( NsVisFace & face );
+    void CalcNsVisFlux( NsVisFace & face );
+    void ZeroHeatFlux( NsVisFace & face );
+    void AddChemHeatFlux( NsVisFace & face );
+    void AddHeatFlux( NsVisFace & face );
+    void SaveHeatFlux( NsVisFace & face );
+    void PushHeatFlux();
 
     void Alloc();
     void DeAlloc();
 public:
-    void PrepareFaceValue();
-    void SaveFacePara();
-    void CalcFaceWeight();
+    void PrepareFaceValue( NsVisFace & face );
+    void SaveFacePara( NsVisFace & face );
+    void CalcFaceWeight( NsVisFace & face );
 public:
-    void AverMethod();
-    void StdMethod();
-    void TestMethod();
-    void New1Method();
-    void New2Method();
-    void CalcGradCoef();
-    void PrepareCellGeom();
+    void AverMethod( NsVisFace & face );
+    void StdMethod( NsVisFace & face );
+    void TestMethod( NsVisFace & face );
+    void New1Method( NsVisFace & face );
+    void New2Method( NsVisFace & face );
+    void CalcGradCoef( NsVisFace & face );
+    void PrepareCellGeom( NsVisFace & face );
 };
 
 void CalcLaminarViscosity( int flag );
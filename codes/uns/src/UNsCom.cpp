@@ -26,12 +26,11 @@ License
 #include "UnsGrid.h"
 #include "Zone.h"
 #include "DataBase.h"
-#include "Ctrl.h"
-#include "TimeIntegral.h"
 
 BeginNameSpace( ONEFLOW )
 
 UNsField unsf;
+UNsFieldHandle unsh;
 
 UNsField::UNsField()
 {
@@ -43,49 +42,80 @@ UNsField::~UNsField()
     ;
 }
 
+UNsFieldHandle::UNsFieldHandle() :
+    q( "q" ),
+    q1( "q1" ),
+    q2( "q2" ),
+    dq( "dq" ),
+    limiter( "limiter" ),
+    gama( "gama" ),
+    dqdx( "dqdx" ),
+    dqdy( "dqdy" ),
+    dqdz( "dqdz" ),
+    dtdx( "dtdx" ),
+    dtdy( "dtdy" ),
+    dtdz( "dtdz" ),
+    bc_q( "bc_q" ),
+    bcdqdx( "bcdqdx" ),
+    bcdqdy( "bcdqdy" ),
+    bcdqdz( "bcdqdz" ),
+    visl( "visl" ),
+    vist( "vist" ),
+    tempr( "tempr" ),
+    timestep( "timestep" ),
+    invsr( "invsr" ),
+    vissr( "vissr" ),
+    impsr( "impsr" ),
+    res( "res" ),
+    res1( "res1" ),
+    res2( "res2" )
+{
+    ;
+}
+
+UNsFieldHandle::~UNsFieldHandle()
+{
+    ;
+}
+
 void UNsField::Init()
 {
     UnsGrid * grid = Zone::GetUnsGrid();
 
-    q  = GetFieldPointer< MRField > ( grid, "q" );
-    q1  = GetFieldPointer< MRField > ( grid, "q1" );
-    q2  = GetFieldPointer< MRField > ( grid, "q2" );
-    dq  = GetFieldPointer< MRField > ( grid, "dq" );
-    limiter  = GetFieldPointer< MRField > ( grid, "limiter" );
-    gama  = GetFieldPointer< MRField > ( grid, "gama" );
-    dqdx  = GetFieldPointer< MRField > ( grid, "dqdx" );
-    dqdy  = GetFieldPointer< MRField > ( grid, "dqdy" );
-    dqdz  = GetFieldPointer< MRField > ( grid, "dqdz" );
+    q  = GetFieldPointer< MRField >( grid, unsh.q );
+    q1  = GetFieldPointer< MRField >( grid, unsh.q1 );
+    q2  = GetFieldPointer< MRField >( grid, unsh.q2 );
+    dq  = GetFieldPointer< MCField >( grid, unsh.dq );
+    limiter  = GetFieldPointer< MRField >( grid, unsh.limiter );
+    gama  = GetFieldPointer< MRField >( grid, unsh.gama );
+    dqdx  = GetFieldPointer< MRField >( grid, unsh.dqdx );
+    dqdy  = GetFieldPointer< MRField >( grid, unsh.dqdy );
+    dqdz  = GetFieldPointer< MRField >( grid, unsh.dqdz );
 
-    dtdx  = GetFieldPointer< MRField > ( grid, "dtdx" );
-    dtdy  = GetFieldPointer< MRField > ( grid, "dtdy" );
-    dtdz  = GetFieldPointer< MRField > ( grid, "dtdz" );
-    bc_q    = GetFieldPointer< MRField > ( grid, "bc_q" );
-    bcdqdx  = GetFieldPointer< MRField > ( grid, "bcdqdx" );
-    bcdqdy  = GetFieldPointer< MRField > ( grid, "bcdqdy" );
-    bcdqdz  = GetFieldPointer< MRField > ( grid, "bcdqdz" );
+    dtdx  = GetFieldPointer< MRField >( grid, unsh.dtdx );
+    dtdy  = GetFieldPointer< MRField >( grid, unsh.dtdy );
+    dtdz  = GetFieldPointer< MRField >( grid, unsh.dtdz );
+    bc_q    = GetFieldPointer< MRField >( grid, unsh.bc_q );
+    bcdqdx  = GetFieldPointer< MRField >( grid, unsh.bcdqdx );
+    bcdqdy  = GetFieldPointer< MRField >( grid, unsh.bcdqdy );
+    bcdqdz  = GetFieldPointer< MRField >( grid, unsh.bcdqdz );
 
-    visl  = GetFieldPointer< MRField > ( grid, "visl" );
-    vist  = GetFieldPointer< MRField > ( grid, "vist" );
+    visl  = GetFieldPointer< MRField >( grid, unsh.visl );
+    vist  = GetFieldPointer< MRField >( grid, unsh.vist );
 
-    tempr = GetFieldPointer< MRField >( grid, "tempr" );
+    tempr = GetFieldPointer< MRField >( grid, unsh.tempr );
 
-    timestep = GetFieldPointer< MRField >( grid, "timestep" );
+    timestep = GetFieldPointer< MRField >( grid, unsh.timestep );
 
-    invsr = ONEFLOW::GetFieldPointer< MRField >( grid, "invsr" );
-    vissr = ONEFLOW::GetFieldPointer< MRField >( grid, "vissr" );
-    impsr = ONEFLOW::GetFieldPointer< MRField >( grid, "impsr" );
+    invsr = GetFieldPointer< MRField >( grid, unsh.invsr );
+    vissr = GetFieldPointer< MRField >( grid, unsh.vissr );
+    impsr = GetFieldPointer< MRField >( grid, unsh.impsr );
 
-    res  = GetFieldPointer< MRField > ( grid, "res" );
-    res1  = GetFieldPointer< MRField > ( grid, "res1" );
-    res2  = GetFieldPointer< MRField > ( grid, "res2" );
+    res  = GetFieldPointer< MRField >( grid, unsh.res );
+    res1  = GetFieldPointer< MRField >( grid, unsh.res1 );
+    res2  = GetFieldPointer< MRField >( grid, unsh.res2 );
 
     rhs = res;
-
-    if ( ctrl.time_integral == MULTI_STAGE )
-    {
-        dq = res;
-    }
 }
 
 EndNameSpace
@@ -23,6 +23,7 @@ License
 #include "UNsGrad.h"
 #include "UCom.h"
 #include "NsCom.h"
+#include "UNsCom.h"
 #include "DataBase.h"
 #include "FieldImp.h"
 #include "FaceTopo.h"
@@ -57,13 +58,13 @@ void UNsGrad::Init()
     namey = "dqdy";
     namez = "dqdz";
 
-    q    = GetFieldPointer< MRField > ( grid, name  );
-    dqdx = GetFieldPointer< MRField > ( grid, namex );
-    dqdy = GetFieldPointer< MRField > ( grid, namey );
-    dqdz = GetFieldPointer< MRField > ( grid, namez );
-    bdqdx = GetFieldPointer< MRField > ( grid, "bcdqdx" );
-    bdqdy = GetFieldPointer< MRField > ( grid, "bcdqdy" );
-    bdqdz = GetFieldPointer< MRField > ( grid, "bcdqdz" );
+    q    = GetFieldPointer< MRField > ( grid, unsh.q    );
+    dqdx = GetFieldPointer< MRField > ( grid, unsh.dqdx );
+    dqdy = GetFieldPointer< MRField > ( grid, unsh.dqdy );
+    dqdz = GetFieldPointer< MRField > ( grid, unsh.dqdz );
+    bdqdx = GetFieldPointer< MRField > ( grid, unsh.bcdqdx );
+    bdqdy = GetFieldPointer< MRField > ( grid, unsh.bcdqdy );
+    bdqdz = GetFieldPointer< MRField > ( grid, unsh.bcdqdz );
 
     this->nEqu = nscom.nTEqu;
 
@@ -89,10 +90,10 @@ void UTGrad::Init()
     namey = "dtdy";
     namez = "dtdz";
 
-    q    = GetFieldPointer< MRField > ( grid, name  );
-    dqdx = GetFieldPointer< MRField > ( grid, namex );
-    dqdy = GetFieldPointer< MRField > ( grid, namey );
-    dqdz = GetFieldPointer< MRField > ( grid, namez );
+    q    = GetFieldPointer< MRField > ( grid, unsh.tempr );
+    dqdx = GetFieldPointer< MRField > ( grid, unsh.dtdx  );
+    dqdy = GetFieldPointer< MRField > ( grid, unsh.dtdy  );
+    dqdz = GetFieldPointer< MRField > ( grid, unsh.dtdz  );
 
     this->nEqu = nscom.nTModel;
 
@@ -21,6 +21,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "UNsInvFlux.h"
+#include "NsInvFluxImp.h"
 #include "UNsGrad.h"
 #include "Zone.h"
 #include "Atmosphere.h"
@@ -38,6 +39,8 @@ License
 #include "Iteration.h"
 #include "TurbCom.h"
 #include "UTurbCom.h"
+#include "Com.h"
+#include "Ctrl.h"
 #include <iostream>
 #include <iomanip>
 
@@ -67,6 +70,8 @@ void UNsInvFlux::CalcInvFace()
 
     this->CalcLimiter();
 
+    if ( ctrl.fuserecon == 1 ) return;
+
     this->GetQlQrField();
 
     this->ReconstructFaceValueField();
@@ -128,7 +133,7 @@ void UNsInvFlux::CalcFlux()
     unsf.Init();
     Alloc();
 
-    this->SetPointer( nscom.ischeme );
+    this->SetFaceLoop( nscom.ischeme );
 
     //ReadTmp();
     this->CalcInvFace();
@@ -138,63 +143,272 @@ void UNsInvFlux::CalcFlux()
     DeAlloc();
 }
 
+void UNsInvFlux::SetFaceLoop( int schemeId )
+{
+    InvFluxBatchPointer batchScheme = ONEFLOW::GetInvFluxBatch( schemeId );
+
+    if ( batchScheme == & RoeBatch )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxBatchLoop< & RoeBatch >;
+    }
+    else if ( batchScheme == & Slau2Batch )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxBatchLoop< & Slau2Batch >;
+    }
+    else if ( schemeId == ISCHEME_ROE )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Roe >;
+    }
+    else if ( schemeId == ISCHEME_HYBRIDROE )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::HybridRoe >;
+    }
+    else if ( schemeId == ISCHEME_AUSMP )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Ausmp >;
+    }
+    else if ( schemeId == ISCHEME_AUSMPUP )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::AusmpUp >;
+    }
+    else if ( schemeId == ISCHEME_AUSMDV )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Ausmdv >;
+    }
+    else if ( schemeId == ISCHEME_AUSMW )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Ausmw >;
+    }
+    else if ( schemeId == ISCHEME_AUSMPW )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Ausmpw >;
+    }
+    else if ( schemeId == ISCHEME_VANLEER )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Vanleer >;
+    }
+    else if ( schemeId == ISCHEME_STEGER )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Steger >;
+    }
+    else if ( schemeId == ISCHEME_HLLE )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Hlle >;
+    }
+    else if ( schemeId == ISCHEME_LAX_FRIEDRICHS )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::LaxFriedrichs >;
+    }
+    else if ( schemeId == ISCHEME_SLAU2 )
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Slau2 >;
+    }
+    else
+    {
+        faceLoopPointer = & UNsInvFlux::CalcInvFluxLoop< & NsInvFlux::Roe >;
+    }
+}
+
 void UNsInvFlux::CalcInvFlux()
 {
-    for ( int fId = 0; fId < ug.nFaces; ++ fId )
+    ( this->*faceLoopPointer )();
+}
+
+template < NsInvFlux::InvFluxPointer scheme >
+void UNsInvFlux::CalcInvFluxLoop()
+{
+    //every thread owns its face context, the faces only write their own invflux entries
+#pragma omp parallel num_threads( ctrl.nthreads )
     {
-        ug.fId = fId;
+        NsInv faceInv;
+        GCom faceGeom;
+        faceInv.Init();
 
-        if ( fId == 24 )
+        if ( this->res && ctrl.nthreads > 1 )
         {
-            int kkk = 1;
+            //the faces add to the residual directly, faces of one color never share a cell
+            int nColors = ug.colorStart->size() - 1;
+            for ( int iColor = 0; iColor < nColors; ++ iColor )
+            {
+                int st = ( * ug.colorStart )[ iColor     ];
+                int ed = ( * ug.colorStart )[ iColor + 1 ];
+
+#pragma omp for schedule( static )
+                for ( int i = st; i < ed; ++ i )
+                {
+                    this->CalcFaceInvFlux< scheme >( ( * ug.colorFaces )[ i ], faceInv, faceGeom );
+                }
+            }
         }
+        else
+        {
+#pragma omp for schedule( static )
+            for ( int fId = 0; fId < ug.nFaces; ++ fId )
+            {
+                this->CalcFaceInvFlux< scheme >( fId, faceInv, faceGeom );
+            }
+        }
+    }
+}
 
-        ug.lc = ( * ug.lcf )[ ug.fId ];
-        ug.rc = ( * ug.rcf )[ ug.fId ];
+template < NsInvFlux::InvFluxPointer scheme >
+void UNsInvFlux::CalcFaceInvFlux( int fId, NsInv & inv, GCom & gcom )
+{
+    this->PrepareFaceValue( fId, inv, gcom );
 
-        this->PrepareFaceValue();
+    ( this->*scheme )( inv, gcom );
 
-        ( this->*invFluxPointer )();
+    this->UpdateFaceInvFlux( fId, inv, gcom );
+}
+
+template < InvFluxBatchPointer scheme >
+void UNsInvFlux::CalcInvFluxBatchLoop()
+{
+#pragma omp parallel num_threads( ctrl.nthreads )
+    {
+        NsInv faceInv;
+        GCom faceGeom;
+        NsInvBatch batch;
+        faceInv.Init();
+
+        if ( this->res && ctrl.nthreads > 1 )
+        {
+            int nColors = ug.colorStart->size() - 1;
+            for ( int iColor = 0; iColor < nColors; ++ iColor )
+            {
+                int st = ( * ug.colorStart )[ iColor     ];
+                int ed = ( * ug.colorStart )[ iColor + 1 ];
+                int nBatches = ( ed - st + NS_BATCH - 1 ) / NS_BATCH;
+
+#pragma omp for schedule( static )
+                for ( int iBatch = 0; iBatch < nBatches; ++ iBatch )
+                {
+                    int ist = st + iBatch * NS_BATCH;
+                    batch.nFace = MIN( NS_BATCH, ed - ist );
+                    for ( int i = 0; i < batch.nFace; ++ i )
+                    {
+                        batch.fId[ i ] = ( * ug.colorFaces )[ ist + i ];
+                    }
+                    this->CalcBatchInvFlux< scheme >( batch, faceInv, faceGeom );
+                }
+            }
+        }
+        else
+        {
+            int nBatches = ( ug.nFaces + NS_BATCH - 1 ) / NS_BATCH;
+
+#pragma omp for schedule( static )
+            for ( int iBatch = 0; iBatch < nBatches; ++ iBatch )
+            {
+                int ist = iBatch * NS_BATCH;
+                batch.nFace = MIN( NS_BATCH, ug.nFaces - ist );
+                for ( int i = 0; i < batch.nFace; ++ i )
+                {
+                    batch.fId[ i ] = ist + i;
+                }
+                this->CalcBatchInvFlux< scheme >( batch, faceInv, faceGeom );
+            }
+        }
+    }
+}
+
+template < InvFluxBatchPointer scheme >
+void UNsInvFlux::CalcBatchInvFlux( NsInvBatch & batch, NsInv & inv, GCom & gcom )
+{
+    for ( int i = 0; i < batch.nFace; ++ i )
+    {
+        this->PrepareFaceValue( batch.fId[ i ], inv, gcom );
+
+        batch.xfn  [ i ] = gcom.xfn;
+        batch.yfn  [ i ] = gcom.yfn;
+        batch.zfn  [ i ] = gcom.zfn;
+        batch.vfn  [ i ] = gcom.vfn;
+        batch.gama1[ i ] = inv.gama1;
+        batch.gama2[ i ] = inv.gama2;
+
+        for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+        {
+            batch.prim1[ iEqu ][ i ] = inv.prim1[ iEqu ];
+            batch.prim2[ iEqu ][ i ] = inv.prim2[ iEqu ];
+        }
+    }
+
+    batch.FillEmptyLanes();
+
+    ( * scheme )( batch );
 
-        this->UpdateFaceInvFlux();
+    for ( int i = 0; i < batch.nFace; ++ i )
+    {
+        int fId = batch.fId[ i ];
+        gcom.farea = ( * ug.farea )[ fId ];
+
+        for ( int iEqu = 0; iEqu < NS_BATCH_NEQU; ++ iEqu )
+        {
+            inv.flux[ iEqu ] = batch.flux[ iEqu ][ i ];
+        }
+
+        this->UpdateFaceInvFlux( fId, inv, gcom );
     }
 }
 
-void UNsInvFlux::PrepareFaceValue()
+void UNsInvFlux::PrepareFaceValue( int fId, NsInv & inv, GCom & gcom )
 {
-    gcom.xfn   = ( * ug.xfn   )[ ug.fId ];
-    gcom.yfn   = ( * ug.yfn   )[ ug.fId ];
-    gcom.zfn   = ( * ug.zfn   )[ ug.fId ];
-    gcom.vfn   = ( * ug.vfn   )[ ug.fId ];
-    gcom.farea = ( * ug.farea )[ ug.fId ];
-
-    nscom.gama1 = ( * unsf.gama )[ 0 ][ ug.lc ];
-    nscom.gama2 = ( * unsf.gama )[ 0 ][ ug.rc ];
-    nscom.gama  = half * ( nscom.gama1 + nscom.gama2 );
-
-    inv.gama1 = nscom.gama1;
-    inv.gama2 = nscom.gama2;
+    int lc = ( * ug.lcf )[ fId ];
+    int rc = ( * ug.rcf )[ fId ];
+
+    gcom.xfn   = ( * ug.xfn   )[ fId ];
+    gcom.yfn   = ( * ug.yfn   )[ fId ];
+    gcom.zfn   = ( * ug.zfn   )[ fId ];
+    gcom.vfn   = ( * ug.vfn   )[ fId ];
+    gcom.farea = ( * ug.farea )[ fId ];
+
+    inv.gama1 = ( * unsf.gama )[ 0 ][ lc ];
+    inv.gama2 = ( * unsf.gama )[ 0 ][ rc ];
     inv.gama  = half * ( inv.gama1 + inv.gama2 );
 
+    if ( ctrl.fuserecon == 1 )
+    {
+        limf->CalcFaceQlQr( fId, inv.prim1, inv.prim2 );
+        return;
+    }
+
     for ( int iEqu = 0; iEqu < limf->nEqu; ++ iEqu )
     {
-        inv.prim1[ iEqu ] = ( * limf->qf1 )[ iEqu ][ ug.fId ];
-        inv.prim2[ iEqu ] = ( * limf->qf2 )[ iEqu ][ ug.fId ];
+        inv.prim1[ iEqu ] = ( * limf->qf1 )[ iEqu ][ fId ];
+        inv.prim2[ iEqu ] = ( * limf->qf2 )[ iEqu ][ fId ];
     }
 }
 
-void UNsInvFlux::UpdateFaceInvFlux()
+void UNsInvFlux::UpdateFaceInvFlux( int fId, NsInv & inv, GCom & gcom )
 {
+    if ( this->res )
+    {
+        int lc = ( * ug.lcf )[ fId ];
+        int rc = ( * ug.rcf )[ fId ];
+
+        for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
+        {
+            Real flux = gcom.farea * inv.flux[ iEqu ];
+            ( * res )[ iEqu ][ lc ] -= flux;
+            if ( fId < ug.nBFaces ) continue;
+            ( * res )[ iEqu ][ rc ] += flux;
+        }
+        return;
+    }
+
     for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
     {
-        ( * invflux )[ iEqu ][ ug.fId ] = gcom.farea * inv.flux[ iEqu ];
+        ( * invflux )[ iEqu ][ fId ] = gcom.farea * inv.flux[ iEqu ];
     }
 }
 
 void UNsInvFlux::AddInvFlux()
 {
+    //already added to the residual by the face loop
+    if ( ! invflux ) return;
+
     UnsGrid * grid = Zone::GetUnsGrid();
-    MRField * res = GetFieldPointer< MRField >( grid, "res" );
+    MRField * res = GetFieldPointer< MRField >( grid, unsh.res );
 
     ONEFLOW::AddF2CField( res, invflux );
     if ( Iteration::outerSteps == -31 )
@@ -203,7 +417,7 @@ void UNsInvFlux::AddInvFlux()
         Real mindiff = 1.0e-10;
         int idumpface = 1;
         int idumpcell = 0;
-        MRField * q = GetFieldPointer< MRField >( grid, "q" );
+        MRField * q = GetFieldPointer< MRField >( grid, unsh.q );
         HXDebug::DumpField( "flow.debug", q );
         HXDebug::CompareFile( 1.0e-12, idumpcell );
 
@@ -216,7 +430,17 @@ void UNsInvFlux::AddInvFlux()
 
 void UNsInvFlux::Alloc()
 {
-    invflux = new MRField( nscom.nEqu, ug.nFaces );
+    invflux = 0;
+    res     = 0;
+
+    if ( ctrl.fusef2c == 1 )
+    {
+        UnsGrid * grid = Zone::GetUnsGrid();
+        res = GetFieldPointer< MRField >( grid, unsh.res );
+        return;
+    }
+
+    invflux = new MRField( nscom.nTEqu, ug.nFaces );
 }
 
 void UNsInvFlux::DeAlloc()
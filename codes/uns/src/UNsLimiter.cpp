@@ -58,10 +58,13 @@ void NsLimField::Init()
 
     this->nEqu = q->GetNEqu();
 
+    this->ckfun = & NsCheckFunction;
+
+    //the fused inviscid kernel reconstructs the face states on the fly
+    if ( ctrl.fuserecon == 1 ) return;
+
     qf1 = new MRField( this->nEqu, grid->nFaces );
     qf2 = new MRField( this->nEqu, grid->nFaces );
-
-    this->ckfun = & NsCheckFunction;
 }
 
 void NsLimField::BcQlQrFix()
@@ -100,6 +103,22 @@ void NsLimField::BcQlQrFix()
     }
 }
 
+bool NsLimField::BcQlQrFix( int fId, int lc, int rc, RealField & ql, RealField & qr )
+{
+    if ( ! LimField::BcQlQrFix( fId, lc, rc, ql, qr ) ) return false;
+
+    if ( ug.bcRecord->bcType[ fId ] == BC::SOLID_SURFACE )
+    {
+        for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+        {
+            ql[ iEqu ] = ( * unsf.bc_q )[ iEqu ][ fId ];
+            qr[ iEqu ] = ( * unsf.bc_q )[ iEqu ][ fId ];
+        }
+    }
+
+    return true;
+}
+
 NsLimiter::NsLimiter()
 {
     limf = new NsLimField();
@@ -34,17 +34,58 @@ License
 #include "HXMath.h"
 #include "Parallel.h"
 #include "Iteration.h"
+#include "ZoneState.h"
+#include "GridState.h"
+#include "Ctrl.h"
 #include <iostream>
 
 
 BeginNameSpace( ONEFLOW )
 
+UNsLusgsOperator::UNsLusgsOperator()
+{
+    this->Reset();
+}
+
+UNsLusgsOperator::~UNsLusgsOperator()
+{
+}
+
+void UNsLusgsOperator::Init( int nFaces )
+{
+    if ( static_cast< int >( lowerRadius.size() ) == nFaces ) return;
+
+    lowerRadius.resize( nFaces );
+    upperRadius.resize( nFaces );
+    lowerVisRad.resize( nFaces );
+    upperVisRad.resize( nFaces );
+    this->Reset();
+}
+
+void UNsLusgsOperator::Reset()
+{
+    spectrumValid = false;
+    lowerValid = false;
+    upperValid = false;
+}
+
 UNsLusgs::UNsLusgs()
 {
+    lusgsOperator = 0;
+    faceRadius = 0;
+    faceVisRad = 0;
+    faceValid = false;
 }
 
 UNsLusgs::~UNsLusgs()
 {
+    for ( int gl = 0; gl < static_cast< int >( operators.size() ); ++ gl )
+    {
+        for ( int i = 0; i < static_cast< int >( operators[ gl ].size() ); ++ i )
+        {
+            delete operators[ gl ][ i ];
+        }
+    }
 }
 
 void UNsLusgs::SingleSweep()
@@ -55,14 +96,68 @@ void UNsLusgs::SingleSweep()
 
 void UNsLusgs::Init()
 {
-    UnsGrid * grid = Zone::GetUnsGrid();
-    FaceTopo * faceTopo = grid->faceTopo;
-    CellTopo * cellTopo = grid->cellMesh->cellTopo;
-    cellTopo->CalcC2f( faceTopo );
+    //ug.Init also builds c2f once per grid
     ug.Init();
     nslu.Init();
     unsf.Init();
-    this->CalcSpectrum();
+
+    this->lusgsOperator = this->GetOperator();
+    this->lusgsOperator->Init( ug.nFaces );
+
+    if ( ! this->lusgsOperator->spectrumValid )
+    {
+        this->CalcSpectrum();
+        this->lusgsOperator->spectrumValid = true;
+    }
+}
+
+//one operator per zone and grid level, the multigrid levels never share spectral radii
+UNsLusgsOperator * UNsLusgs::GetOperator()
+{
+    int gl = GridState::gridLevel;
+    if ( gl >= static_cast< int >( this->operators.size() ) )
+    {
+        this->operators.resize( gl + 1 );
+    }
+
+    HXVector< UNsLusgsOperator * > & levelOperators = this->operators[ gl ];
+    if ( static_cast< int >( levelOperators.size() ) < ZoneState::nZones )
+    {
+        levelOperators.resize( ZoneState::nZones, 0 );
+    }
+
+    UNsLusgsOperator *& zoneOperator = levelOperators[ ZoneState::zid ];
+    if ( ! zoneOperator )
+    {
+        zoneOperator = new UNsLusgsOperator();
+    }
+    return zoneOperator;
+}
+
+void UNsLusgs::ResetOperator()
+{
+    int gl = GridState::gridLevel;
+    if ( gl >= static_cast< int >( this->operators.size() ) ) return;
+    if ( ZoneState::zid >= static_cast< int >( this->operators[ gl ].size() ) ) return;
+
+    UNsLusgsOperator * zoneOperator = this->operators[ gl ][ ZoneState::zid ];
+    if ( zoneOperator ) zoneOperator->Reset();
+}
+
+void UNsLusgs::SetFaceOperator( int signOfSweep )
+{
+    if ( signOfSweep > 0 )
+    {
+        this->faceRadius = & this->lusgsOperator->lowerRadius;
+        this->faceVisRad = & this->lusgsOperator->lowerVisRad;
+        this->faceValid  = this->lusgsOperator->lowerValid;
+    }
+    else
+    {
+        this->faceRadius = & this->lusgsOperator->upperRadius;
+        this->faceVisRad = & this->lusgsOperator->upperVisRad;
+        this->faceValid  = this->lusgsOperator->upperValid;
+    }
 }
 
 void UNsLusgs::CalcSpectrum()
@@ -75,195 +170,311 @@ void UNsLusgs::CalcSpectrum()
 void UNsLusgs::LowerSweep()
 {
     this->Init();
+    this->SetFaceOperator( 1 );
 
-    for ( int cId = 0; cId < ug.nCells; ++ cId )
+    if ( ctrl.nthreads > 1 && ctrl.lusgslevel == 1 )
+    {
+        this->LowerSweepLevel();
+    }
+    else
     {
-        ug.cId = cId;
-        if ( cId == 32 )
+        for ( int cId = 0; cId < ug.nCells; ++ cId )
         {
-            int kkk = 1;
+            this->SweepLowerCell( nslu, cId );
         }
+    }
 
-        gcom.blank = ( * ug.blankf )[ ug.cId ];
+    this->lusgsOperator->lowerValid = true;
+
+    //UploadInterfaceValue( grid, dqField, "dqField",  numberOfTotalEquations );
+}
 
-        if ( this->IsOversetCell() )
+void UNsLusgs::UpperSweep()
+{
+    this->Init();
+    //this->LusgsBoundary();
+    //DownloadInterfaceValue( grid, dqField, "dqField",  numberOfTotalEquations );
+    this->SetFaceOperator( - 1 );
+
+    if ( ctrl.nthreads > 1 && ctrl.lusgslevel == 1 )
+    {
+        this->UpperSweepLevel();
+    }
+    else
+    {
+        for ( int cId = ug.nCells - 1; cId >= 0; -- cId )
         {
-            this->ZeroOversetCell();
+            this->SweepUpperCell( nslu, cId );
         }
-        else
-        {
-            this->PrepareSweep();
+    }
+
+    this->lusgsOperator->upperValid = true;
+}
 
-            this->ZeroFluxIncrement();
-        
-            this->SolveLowerCell();
+void UNsLusgs::LowerSweepLevel()
+{
+    //cells of one level have no lower neighbors inside the level,
+    //so every cell sees the same dq as in the cell ordered sweep
+    int nLevels = ug.lowerLevelStart->size() - 1;
+
+#pragma omp parallel num_threads( ctrl.nthreads )
+    {
+        LusgsData lusgs;
+        lusgs.Init();
+        lusgs.numberOfSweeps = nslu.numberOfSweeps;
+        lusgs.norm = 0.0;
 
-            this->CalcLowerChange();
+        for ( int iLevel = 0; iLevel < nLevels; ++ iLevel )
+        {
+            int st = ( * ug.lowerLevelStart )[ iLevel     ];
+            int ed = ( * ug.lowerLevelStart )[ iLevel + 1 ];
+
+#pragma omp for schedule( static )
+            for ( int i = st; i < ed; ++ i )
+            {
+                this->SweepLowerCell( lusgs, ( * ug.lowerLevelCells )[ i ] );
+            }
         }
 
-        this->Update();
+#pragma omp atomic
+        nslu.norm += lusgs.norm;
     }
-
-    //UploadInterfaceValue( grid, dqField, "dqField",  numberOfTotalEquations );
 }
 
-void UNsLusgs::UpperSweep()
+void UNsLusgs::UpperSweepLevel()
 {
-    this->Init();
-    //this->LusgsBoundary();
-    //DownloadInterfaceValue( grid, dqField, "dqField",  numberOfTotalEquations );
-    
-    for ( int cId = ug.nCells - 1; cId >= 0; -- cId )
+    int nLevels = ug.upperLevelStart->size() - 1;
+
+#pragma omp parallel num_threads( ctrl.nthreads )
     {
-        ug.cId = cId;
-        gcom.blank = ( * ug.blankf )[ ug.cId ];
+        LusgsData lusgs;
+        lusgs.Init();
+        lusgs.numberOfSweeps = nslu.numberOfSweeps;
+        lusgs.norm = 0.0;
 
-        if ( this->IsOversetCell() )
+        for ( int iLevel = 0; iLevel < nLevels; ++ iLevel )
         {
-            this->ZeroOversetCell();
+            int st = ( * ug.upperLevelStart )[ iLevel     ];
+            int ed = ( * ug.upperLevelStart )[ iLevel + 1 ];
+
+#pragma omp for schedule( static )
+            for ( int i = st; i < ed; ++ i )
+            {
+                this->SweepUpperCell( lusgs, ( * ug.upperLevelCells )[ i ] );
+            }
         }
-        else
-        {
-            this->PrepareSweep();
 
-            this->ZeroFluxIncrement();
+#pragma omp atomic
+        nslu.norm += lusgs.norm;
+    }
+}
 
-            this->SolveUpperCell();
+void UNsLusgs::SweepLowerCell( LusgsData & nslu, int cId )
+{
+    nslu.cId = cId;
+    nslu.gcom.blank = ( * ug.blankf )[ nslu.cId ];
 
-            this->CalcUpperChange();
-        }
+    if ( this->IsOversetCell( nslu ) )
+    {
+        this->ZeroOversetCell( nslu );
+    }
+    else
+    {
+        this->PrepareSweep( nslu );
 
-        this->Update();
+        this->ZeroFluxIncrement( nslu );
+
+        this->SolveLowerCell( nslu );
+
+        this->CalcLowerChange( nslu );
     }
+
+    this->Update( nslu );
 }
 
-void UNsLusgs::SolveLowerCell()
+void UNsLusgs::SweepUpperCell( LusgsData & nslu, int cId )
 {
-    int fn = ( * ug.c2f )[ ug.cId ].size();
+    nslu.cId = cId;
+    nslu.gcom.blank = ( * ug.blankf )[ nslu.cId ];
+
+    if ( this->IsOversetCell( nslu ) )
+    {
+        this->ZeroOversetCell( nslu );
+    }
+    else
+    {
+        this->PrepareSweep( nslu );
+
+        this->ZeroFluxIncrement( nslu );
+
+        this->SolveUpperCell( nslu );
+
+        this->CalcUpperChange( nslu );
+    }
+
+    this->Update( nslu );
+}
+
+void UNsLusgs::SolveLowerCell( LusgsData & nslu )
+{
+    int fn = ( * ug.c2f )[ nslu.cId ].size();
     for ( int iFace = 0; iFace < fn; ++ iFace )
     {
-        int fId = ( * ug.c2f )[ ug.cId ][ iFace ];
-        this->SolveLower( fId );
+        int fId = ( * ug.c2f )[ nslu.cId ][ iFace ];
+        this->SolveLower( nslu, fId );
     }
 }
 
-void UNsLusgs::SolveUpperCell()
+void UNsLusgs::SolveUpperCell( LusgsData & nslu )
 {
-    int fn = ( * ug.c2f )[ ug.cId ].size();
+    int fn = ( * ug.c2f )[ nslu.cId ].size();
     for ( int iFace = 0; iFace < fn; ++ iFace )
     {
-        int fId = ( * ug.c2f )[ ug.cId ][ iFace ];
-        this->SolveUpper( fId );
+        int fId = ( * ug.c2f )[ nslu.cId ][ iFace ];
+        this->SolveUpper( nslu, fId );
     }
 }
 
-void UNsLusgs::SolveLower( int fId )
+void UNsLusgs::SolveLower( LusgsData & nslu, int fId )
 {
-    if ( this->CanNotLowerSolve( fId ) ) return;
+    if ( this->CanNotLowerSolve( nslu, fId ) ) return;
 
-    this->Solve( fId, - 1 );
+    this->Solve( nslu, fId, - 1 );
 }
 
-void UNsLusgs::SolveUpper( int fId )
+void UNsLusgs::SolveUpper( LusgsData & nslu, int fId )
 {
-    if ( this->CanNotUpperSolve( fId ) ) return;
+    if ( this->CanNotUpperSolve( nslu, fId ) ) return;
 
-    this->Solve( fId, - 1 );
+    this->Solve( nslu, fId, - 1 );
 }
 
-bool UNsLusgs::CanNotLowerSolve( int fId )
+bool UNsLusgs::CanNotLowerSolve( LusgsData & nslu, int fId )
 {
-    ug.fId = fId;
+    nslu.fId = fId;
 
-    ug.lc = ( * ug.lcf )[ ug.fId ];
-    ug.rc = ( * ug.rcf )[ ug.fId ];
+    nslu.lc = ( * ug.lcf )[ nslu.fId ];
+    nslu.rc = ( * ug.rcf )[ nslu.fId ];
 
     // One of lc  and rc must be cell itself.
     // Now its neighboring cell belongs to lower triangular
-    return ( ug.lc > ug.cId || ug.rc > ug.cId );
+    return ( nslu.lc > nslu.cId || nslu.rc > nslu.cId );
 }
 
-bool UNsLusgs::CanNotUpperSolve( int fId )
+bool UNsLusgs::CanNotUpperSolve( LusgsData & nslu, int fId )
 {
-    ug.fId = fId;
+    nslu.fId = fId;
 
-    ug.lc = ( * ug.lcf )[ ug.fId ];
-    ug.rc = ( * ug.rcf )[ ug.fId ];
+    nslu.lc = ( * ug.lcf )[ nslu.fId ];
+    nslu.rc = ( * ug.rcf )[ nslu.fId ];
 
     // One of lc  and rc must be cell itself.
     // Now its neighboring cell belongs to upper triangular
-    return ( ug.lc < ug.cId || ug.rc < ug.cId );
+    return ( nslu.lc < nslu.cId || nslu.rc < nslu.cId );
 }
 
-void UNsLusgs::Solve( int fId, int signValue )
+void UNsLusgs::Solve( LusgsData & nslu, int fId, int signValue )
 {
-    ug.fId = fId;
+    nslu.fId = fId;
 
     if ( fId == 147489 )
     {
         int kkk = 1;
     }
 
-    ug.lc = ( * ug.lcf )[ ug.fId ];
-    ug.rc = ( * ug.rcf )[ ug.fId ];
+    nslu.lc = ( * ug.lcf )[ nslu.fId ];
+    nslu.rc = ( * ug.rcf )[ nslu.fId ];
+
+    this->SetMeshGeometry( nslu );
+
+    this->PrepareData( nslu );
+
+    this->CalcFaceRadius( nslu );
+
+    this->GetStandardFluxIncrement( nslu, signValue );
+
+    if ( vis_model.vismodel != 0 )
+    {
+        this->AddViscousTerm( nslu );
+    }
+
+    this->AddFluxIncrement( nslu );
+}
 
-    this->SetMeshGeometry();
+void UNsLusgs::CalcFaceRadius( LusgsData & nslu )
+{
+    //every face is solved by the same cell in all the sweeps of one direction
+    if ( this->faceValid )
+    {
+        Real lmd = ( * this->faceRadius )[ nslu.fId ];
+        nslu.lmdOnFace1 = lmd;
+        nslu.lmdOnFace2 = lmd;
+        nslu.lmdOnFace3 = lmd;
+        nslu.visrad = ( * this->faceVisRad )[ nslu.fId ];
+        return;
+    }
 
-    this->PrepareData();
+    this->PrepareDataFace( nslu );
 
-    this->GetStandardFluxIncrement( signValue );
+    this->CalcFaceEigenValue( nslu, nslu.primF );
 
-    this->CalcViscousTerm();
+    this->CalcViscousRadius( nslu );
 
-    this->AddFluxIncrement();
+    ( * this->faceRadius )[ nslu.fId ] = nslu.lmdOnFace1;
+    ( * this->faceVisRad )[ nslu.fId ] = nslu.visrad;
 }
 
-void UNsLusgs::SetMeshGeometry()
+void UNsLusgs::SetMeshGeometry( LusgsData & nslu )
 {
-    gcom.SetGeometry();
+    nslu.gcom.SetGeometry( nslu.fId, nslu.cId, nslu.lc, nslu.rc );
 }
 
-void UNsLusgs::PrepareData()
+void UNsLusgs::PrepareData( LusgsData & nslu )
 {
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
-        nslu.primj[ iEqu ] = ( * unsf.q )[ iEqu ][ ug.rc ]; //Qfield is the original variable!
+        nslu.primj[ iEqu ] = ( * unsf.q )[ iEqu ][ nslu.rc ]; //Qfield is the original variable!
     }
 
+    Real * dqj = unsf.dq->GetCell( nslu.rc );
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
-        nslu.dqj[ iEqu ] = ( * unsf.dq )[ iEqu ][ ug.rc ];
+        nslu.dqj[ iEqu ] = dqj[ iEqu ];
     }
 
-    this->PrepareDataFacePrim();
+    nslu.gama = ( * unsf.gama )[ 0 ][ nslu.rc ];
+}
 
-    nslu.gama = ( * unsf.gama )[ 0 ][ ug.rc ];
-    nscom.visl = ( * unsf.visl )[ 0 ][ ug.rc ];
-    nscom.vist = ( * unsf.vist )[ 0 ][ ug.rc ];
+void UNsLusgs::PrepareDataFace( LusgsData & nslu )
+{
+    this->PrepareDataFacePrim( nslu );
+
+    nslu.visl = ( * unsf.visl )[ 0 ][ nslu.rc ];
+    nslu.vist = ( * unsf.vist )[ 0 ][ nslu.rc ];
 
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
-        nscom.q1[ iEqu ] = ( * unsf.q )[ iEqu ][ ug.lc ];
-        nscom.q2[ iEqu ] = ( * unsf.q )[ iEqu ][ ug.rc ];
+        nslu.q1[ iEqu ] = ( * unsf.q )[ iEqu ][ nslu.lc ];
+        nslu.q2[ iEqu ] = ( * unsf.q )[ iEqu ][ nslu.rc ];
     }
 }
 
-void UNsLusgs::PrepareDataFacePrim()
+void UNsLusgs::PrepareDataFacePrim( LusgsData & nslu )
 {
-    Real rl = ( * unsf.q )[ IDX::IR ][ ug.lc ];
-    Real ul = ( * unsf.q )[ IDX::IU ][ ug.lc ];
-    Real vl = ( * unsf.q )[ IDX::IV ][ ug.lc ];
-    Real wl = ( * unsf.q )[ IDX::IW ][ ug.lc ];
-    Real pl = ( * unsf.q )[ IDX::IP ][ ug.lc ];
+    Real rl = ( * unsf.q )[ IDX::IR ][ nslu.lc ];
+    Real ul = ( * unsf.q )[ IDX::IU ][ nslu.lc ];
+    Real vl = ( * unsf.q )[ IDX::IV ][ nslu.lc ];
+    Real wl = ( * unsf.q )[ IDX::IW ][ nslu.lc ];
+    Real pl = ( * unsf.q )[ IDX::IP ][ nslu.lc ];
 
-    Real rr = ( * unsf.q )[ IDX::IR ][ ug.rc ];
-    Real ur = ( * unsf.q )[ IDX::IU ][ ug.rc ];
-    Real vr = ( * unsf.q )[ IDX::IV ][ ug.rc ];
-    Real wr = ( * unsf.q )[ IDX::IW ][ ug.rc ];
-    Real pr = ( * unsf.q )[ IDX::IP ][ ug.rc ];
+    Real rr = ( * unsf.q )[ IDX::IR ][ nslu.rc ];
+    Real ur = ( * unsf.q )[ IDX::IU ][ nslu.rc ];
+    Real vr = ( * unsf.q )[ IDX::IV ][ nslu.rc ];
+    Real wr = ( * unsf.q )[ IDX::IW ][ nslu.rc ];
+    Real pr = ( * unsf.q )[ IDX::IP ][ nslu.rc ];
 
-    Real gl = ( * unsf.gama )[ 0 ][ ug.lc ];
-    Real gr = ( * unsf.gama )[ 0 ][ ug.rc ];
+    Real gl = ( * unsf.gama )[ 0 ][ nslu.lc ];
+    Real gr = ( * unsf.gama )[ 0 ][ nslu.rc ];
 
     Real hl = gl / ( gl - 1.0 ) * pl / rl + half * SQR( ul, vl, wl );
     Real hr = gr / ( gr - 1.0 ) * pr / rr + half * SQR( ur, vr, wr );
@@ -288,26 +499,30 @@ void UNsLusgs::PrepareDataFacePrim()
 
     for ( int iEqu = nslu.nBEqu; iEqu < nslu.nEqu; ++ iEqu ) 
     {
-        nslu.primF[ iEqu ] = half * ( ( * unsf.q )[ iEqu ][ ug.lc ] + ( * unsf.q )[ iEqu ][ ug.rc ] ); 
+        nslu.primF[ iEqu ] = half * ( ( * unsf.q )[ iEqu ][ nslu.lc ] + ( * unsf.q )[ iEqu ][ nslu.rc ] ); 
     }
 }
 
-void UNsLusgs::CalcViscousTerm()
+void UNsLusgs::CalcViscousRadius( LusgsData & nslu )
 {
+    nslu.visrad = 0.0;
+
     if ( vis_model.vismodel == 0 ) return;
 
+    GCom & gcom = nslu.gcom;
+
     if ( nscom.visSRModel == 1 )
     {
-        Real density = half * ( nscom.q1[ IDX::IR ] + nscom.q2[ IDX::IR ] );
+        Real density = half * ( nslu.q1[ IDX::IR ] + nslu.q2[ IDX::IR ] );
 
-        Real c1 = 4.0 / 3.0 * ( nscom.visl + nscom.vist );
-        Real c2 = nscom.gama * ( nscom.visl * nscom.oprl + nscom.vist * nscom.oprt );
+        Real c1 = 4.0 / 3.0 * ( nslu.visl + nslu.vist );
+        Real c2 = nscom.gama * ( nslu.visl * nscom.oprl + nslu.vist * nscom.oprt );
         Real c3 = two * MAX( c1, c2 ) / ( nscom.reynolds * density );
         Real farea2 = SQR( gcom.farea );
 
-        nscom.vissr = farea2 * c3;
+        nslu.vissr = farea2 * c3;
 
-        nslu.visrad = nscom.vissr / ( * ug.cvol )[ ug.rc ];
+        nslu.visrad = nslu.vissr / ( * ug.cvol )[ nslu.rc ];
     }
     else
     {
@@ -315,28 +530,24 @@ void UNsLusgs::CalcViscousTerm()
                         + gcom.yfn * ( gcom.ycc2 - gcom.ycc1 )
                         + gcom.zfn * ( gcom.zcc2 - gcom.zcc1 ) );
 
-        Real viscosity = nscom.visl + nscom.vist;
-        Real density   = half * ( nscom.q1[ IDX::IR ] + nscom.q2[ IDX::IR ] );
+        Real viscosity = nslu.visl + nslu.vist;
+        Real density   = half * ( nslu.q1[ IDX::IR ] + nslu.q2[ IDX::IR ] );
 
         Real c1  = 2.0 * viscosity / ( density * dist * nscom.reynolds + SMALL );
-        nscom.vissr = half * c1 * gcom.farea;
-        nslu.visrad = nscom.vissr;
-    }
-
-    for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
-    {
-        nslu.rhs0[ iEqu ] -= nslu.visrad * nslu.dqj[ iEqu ];
+        nslu.vissr = half * c1 * gcom.farea;
+        nslu.visrad = nslu.vissr;
     }
 }
 
-void UNsLusgs::PrepareSweep()
+void UNsLusgs::PrepareSweep( LusgsData & nslu )
 {
+    Real * dqi = unsf.dq->GetCell( nslu.cId );
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
-        gcom.blank = ( * ug.blankf )[ ug.cId ];
+        nslu.gcom.blank = ( * ug.blankf )[ nslu.cId ];
 
-        nslu.dqi[ iEqu ] = ( * unsf.dq  )[ iEqu ][ ug.cId ]; //The initial value of dqfield is 0 (conserved or original variable)
-        nslu.rhs[ iEqu ] = ( * unsf.rhs )[ iEqu ][ ug.cId ]; //It is better to have RHS in RHS
+        nslu.dqi[ iEqu ] = dqi[ iEqu ]; //The initial value of dqfield is 0 (conserved or original variable)
+        nslu.rhs[ iEqu ] = ( * unsf.rhs )[ iEqu ][ nslu.cId ]; //It is better to have RHS in RHS
     }
 
     if ( nslu.numberOfSweeps > 1 )
@@ -344,35 +555,36 @@ void UNsLusgs::PrepareSweep()
         for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
         {
             nslu.dqi0[ iEqu ] = nslu.dqi[ iEqu ];
-            nslu.drhs[ iEqu ] = ( * unsf.drhs )[ iEqu ][ ug.cId ];
+            nslu.drhs[ iEqu ] = ( * unsf.drhs )[ iEqu ][ nslu.cId ];
 
-            nslu.dqi[ iEqu ] = ( * unsf.rhs )[ iEqu ][ ug.cId ] - nslu.drhs[ iEqu ];
-            ( * unsf.dq )[ iEqu ][ ug.cId ] = nslu.dqi[ iEqu ];
+            nslu.dqi[ iEqu ] = ( * unsf.rhs )[ iEqu ][ nslu.cId ] - nslu.drhs[ iEqu ];
+            dqi[ iEqu ] = nslu.dqi[ iEqu ];
             nslu.drhs[ iEqu ] = 0.0;
         }
     }
 
     for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
     {
-        nslu.radius[ iEqu ] = ( * unsf.impsr )[ 0 ][ ug.cId ];
+        nslu.radius[ iEqu ] = ( * unsf.impsr )[ 0 ][ nslu.cId ];
     }
 }
 
-void UNsLusgs::Update()
+void UNsLusgs::Update( LusgsData & nslu )
 {
+    Real * dqi = unsf.dq->GetCell( nslu.cId );
     if ( nslu.numberOfSweeps > 1 )
     {
         for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
         {
-            ( * unsf.dq   )[ iEqu ][ ug.cId ]  = nslu.dqi[ iEqu ];
-            ( * unsf.drhs )[ iEqu ][ ug.cId ]  = nslu.drhs[ iEqu ];
+            dqi[ iEqu ] = nslu.dqi[ iEqu ];
+            ( * unsf.drhs )[ iEqu ][ nslu.cId ]  = nslu.drhs[ iEqu ];
         }
     }
     else
     {
         for ( int iEqu = 0; iEqu < nslu.nEqu; ++ iEqu )
         {
-            ( * unsf.dq   )[ iEqu ][ ug.cId ]  = nslu.dqi[ iEqu ];
+            dqi[ iEqu ] = nslu.dqi[ iEqu ];
         }
     }
 }
@@ -27,7 +27,7 @@ License
 #include "UNsCom.h"
 #include "UCom.h"
 #include "NsCom.h"
-#include "NsInvFlux.h"
+#include "NsInvFluxImp.h"
 #include "UnsGrid.h"
 #include "Zone.h"
 #include "DataBase.h"
@@ -29,6 +29,8 @@ License
 #include "ZoneState.h"
 #include "HXMath.h"
 #include "Iteration.h"
+#include "Ctrl.h"
+#include "TimeIntegral.h"
 #include <iostream>
 #include <iomanip>
 
@@ -76,9 +78,21 @@ void UNsUpdate::PrepareData()
         nscom.t0[ iEqu ] = ( * unsf.tempr )[ iEqu ][ ug.cId ];
     }
 
-    for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
+    if ( ctrl.time_integral == MULTI_STAGE )
     {
-        nscom.dq[ iEqu ] = ( * unsf.dq )[ iEqu ][ ug.cId ];
+        //the Runge-Kutta stages advance with the residual
+        for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
+        {
+            nscom.dq[ iEqu ] = ( * unsf.res )[ iEqu ][ ug.cId ];
+        }
+    }
+    else
+    {
+        Real * dq = unsf.dq->GetCell( ug.cId );
+        for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
+        {
+            nscom.dq[ iEqu ] = dq[ iEqu ];
+        }
     }
 
     nscom.gama = ( * unsf.gama )[ 0 ][ ug.cId ];
@@ -40,6 +40,7 @@ License
 #include "ULimiter.h"
 #include "FieldImp.h"
 #include "Iteration.h"
+#include "Ctrl.h"
 #include <iostream>
 #include <iomanip>
 
@@ -92,9 +93,6 @@ void UNsVisFlux::CalcFlux()
     if ( vis_model.vismodel == 0 ) return;
     ug.Init();
     unsf.Init();
-    visQ.Init( nscom.nEqu );
-    visT.Init( nscom.nTModel );
-    vis.Init();
     heat_flux.Init();
 
     Alloc();
@@ -103,6 +101,7 @@ void UNsVisFlux::CalcFlux()
 
     this->PrepareField();
     this->CalcVisFlux();
+    this->PushHeatFlux();
     this->AddVisFlux();
 
     DeAlloc();
@@ -110,7 +109,19 @@ void UNsVisFlux::CalcFlux()
 
 void UNsVisFlux::Alloc()
 {
-    visflux = new MRField( nscom.nEqu, ug.nFaces );
+    bcHeatFlux.resize( ug.nBFaces );
+
+    visflux = 0;
+    res     = 0;
+
+    if ( ctrl.fusef2c == 1 )
+    {
+        UnsGrid * grid = Zone::GetUnsGrid();
+        res = GetFieldPointer< MRField >( grid, "res" );
+        return;
+    }
+
+    visflux = new MRField( nscom.nTEqu, ug.nFaces );
 }
 
 void UNsVisFlux::DeAlloc()
@@ -126,67 +137,108 @@ void UNsVisFlux::PrepareField()
 
 void UNsVisFlux::CalcVisFlux()
 {
-    for ( int fId = 0; fId < ug.nFaces; ++ fId )
+#pragma omp parallel num_threads( ctrl.nthreads )
     {
-        ug.fId = fId;
+        NsVisFace face;
+        face.Init();
+
+        if ( this->res && ctrl.nthreads > 1 )
+        {
+            //the faces add to the residual directly, faces of one color never share a cell
+            int nColors = ug.colorStart->size() - 1;
+            for ( int iColor = 0; iColor < nColors; ++ iColor )
+            {
+                int st = ( * ug.colorStart )[ iColor     ];
+                int ed = ( * ug.colorStart )[ iColor + 1 ];
+
+#pragma omp for schedule( static )
+                for ( int i = st; i < ed; ++ i )
+                {
+                    this->CalcFaceVisFlux( ( * ug.colorFaces )[ i ], face );
+                }
+            }
+        }
+        else
+        {
+#pragma omp for schedule( static )
+            for ( int fId = 0; fId < ug.nFaces; ++ fId )
+            {
+                this->CalcFaceVisFlux( fId, face );
+            }
+        }
+    }
+}
 
-        ug.lc = ( * ug.lcf )[ ug.fId ];
-        ug.rc = ( * ug.rcf )[ ug.fId ];
+void UNsVisFlux::CalcFaceVisFlux( int fId, NsVisFace & face )
+{
+    face.fId = fId;
 
-        this->PrepareFaceValue();
+    face.lc = ( * ug.lcf )[ fId ];
+    face.rc = ( * ug.rcf )[ fId ];
 
-        this->CalcFaceVisFlux();
+    this->PrepareFaceValue( face );
 
-        this->UpdateFaceVisFlux();
-    }
+    this->CalcFaceVisFlux( face );
+
+    this->UpdateFaceVisFlux( face );
 }
 
-void UNsVisFlux::CalcFaceVisFlux()
+void UNsVisFlux::CalcFaceVisFlux( NsVisFace & face )
 {
-    this->CalcHeatFlux();
+    this->CalcHeatFlux( face );
 
-    this->CalcStress();
+    this->CalcStress( face );
 
-    this->CalcNsVisFlux();
+    this->CalcNsVisFlux( face );
 }
 
-void UNsVisFlux::CalcHeatFlux()
+void UNsVisFlux::CalcHeatFlux( NsVisFace & face )
 {
-    this->ZeroHeatFlux();
+    this->ZeroHeatFlux( face );
 
-    this->AddChemHeatFlux();
+    this->AddChemHeatFlux( face );
 
-    this->AddHeatFlux();
+    this->AddHeatFlux( face );
 
-    SaveHeatFlux();
+    SaveHeatFlux( face );
 }
 
-void UNsVisFlux::SaveHeatFlux()
+void UNsVisFlux::SaveHeatFlux( NsVisFace & face )
 {
-    if ( ug.fId >= ug.nBFaces ) return;
-    if ( ug.bcRecord->bcType[ ug.fId ] != BC::SOLID_SURFACE ) return;
+    if ( face.fId >= ug.nBFaces ) return;
+    bcHeatFlux[ face.fId ] = - nscom.oreynolds * face.vis.qNormal;
+}
+
+void UNsVisFlux::PushHeatFlux()
+{
+    //the wall values are appended in face order after the face loop, whatever the threads did
     SurfaceValue * heat_sur = heat_flux.heatflux[ ZoneState::zid ];
-    Real non_dim_heatflux = - nscom.oreynolds * vis.qNormal;
-    heat_sur->var->push_back( non_dim_heatflux );
+    for ( int fId = 0; fId < ug.nBFaces; ++ fId )
+    {
+        if ( ug.bcRecord->bcType[ fId ] != BC::SOLID_SURFACE ) continue;
+        heat_sur->var->push_back( bcHeatFlux[ fId ] );
+    }
 }
 
-void UNsVisFlux::CalcStress()
+void UNsVisFlux::CalcStress( NsVisFace & face )
 {
+    NsVis & vis = face.vis;
     Real divv2p3 = two3rd * ( vis.dudx + vis.dvdy + vis.dwdz );
 
-    vis.txx = nscom.vis * ( two * vis.dudx - divv2p3 );
-    vis.tyy = nscom.vis * ( two * vis.dvdy - divv2p3 );
-    vis.tzz = nscom.vis * ( two * vis.dwdz - divv2p3 );
-    vis.txy = nscom.vis * ( vis.dudy + vis.dvdx );
-    vis.txz = nscom.vis * ( vis.dudz + vis.dwdx );
-    vis.tyz = nscom.vis * ( vis.dvdz + vis.dwdy );
+    vis.txx = face.vism * ( two * vis.dudx - divv2p3 );
+    vis.tyy = face.vism * ( two * vis.dvdy - divv2p3 );
+    vis.tzz = face.vism * ( two * vis.dwdz - divv2p3 );
+    vis.txy = face.vism * ( vis.dudy + vis.dvdx );
+    vis.txz = face.vism * ( vis.dudz + vis.dwdx );
+    vis.tyz = face.vism * ( vis.dvdz + vis.dwdy );
 
-    this->CalcAniStress();
+    this->CalcAniStress( face );
 }
 
-void UNsVisFlux::CalcAniStress()
+void UNsVisFlux::CalcAniStress( NsVisFace & face )
 {
     if ( ctrl.nrokplus <= 0 ) return;
+    NsVis & vis = face.vis;
     Real two3rdRhok = two3rd * vis.rhok;
     vis.txx += vis.b11 - two3rdRhok;
     vis.tyy += vis.b22 - two3rdRhok;
@@ -196,8 +248,10 @@ void UNsVisFlux::CalcAniStress()
     vis.tyz += vis.b23;
 }
 
-void UNsVisFlux::CalcNsVisFlux()
+void UNsVisFlux::CalcNsVisFlux( NsVisFace & face )
 {
+    NsVis & vis = face.vis;
+    GCom & gcom = face.gcom;
     vis.fvis[ IDX::IR  ] = 0.0;
     vis.fvis[ IDX::IRU ] = gcom.xfn * vis.txx + gcom.yfn * vis.txy + gcom.zfn * vis.txz;
     vis.fvis[ IDX::IRV ] = gcom.xfn * vis.txy + gcom.yfn * vis.tyy + gcom.zfn * vis.tyz;
@@ -208,35 +262,41 @@ void UNsVisFlux::CalcNsVisFlux()
 
 }
 
-void UNsVisFlux::ZeroHeatFlux()
+void UNsVisFlux::ZeroHeatFlux( NsVisFace & face )
 {
+    NsVis & vis = face.vis;
     vis.qNormal = 0.0;
     vis.qx      = 0.0;
     vis.qy      = 0.0;
     vis.qz      = 0.0;
 }
 
-void UNsVisFlux::AddChemHeatFlux()
+void UNsVisFlux::AddChemHeatFlux( NsVisFace & )
 {
     if ( nscom.chemModel == 1 )
     {
     }
 }
 
-void UNsVisFlux::AddHeatFlux()
+void UNsVisFlux::AddHeatFlux( NsVisFace & face )
 {
+    NsVis & vis = face.vis;
+    GCom & gcom = face.gcom;
     vis.qNormal = 0.0;
     vis.qx      = 0.0;
     vis.qy      = 0.0;
     vis.qz      = 0.0;
 
-    nscom.kcp = ( nscom.visl * nscom.oprl + nscom.vist * nscom.oprt ) * nscom.const_cp;
+    face.kcp = ( face.visl * nscom.oprl + face.vist * nscom.oprt ) * nscom.const_cp;
     vis.qNormal += gcom.xfn * vis.qx + gcom.yfn * vis.qy + gcom.zfn * vis.qz;
-    vis.qNormal += nscom.kcp * vis.dtdn;
+    vis.qNormal += face.kcp * vis.dtdn;
 }
 
 void UNsVisFlux::AddVisFlux()
 {
+    //already added to the residual by the face loop
+    if ( ! visflux ) return;
+
     UnsGrid * grid = Zone::GetUnsGrid();
     MRField * res = GetFieldPointer< MRField >( grid, "res" );
 
@@ -253,52 +313,59 @@ void UNsVisFlux::AddVisFlux()
     }
 }
 
-void UNsVisFlux::PrepareFaceValue()
+void UNsVisFlux::PrepareFaceValue( NsVisFace & face )
 {
-    gcom.xfn   = ( * ug.xfn   )[ ug.fId ];
-    gcom.yfn   = ( * ug.yfn   )[ ug.fId ];
-    gcom.zfn   = ( * ug.zfn   )[ ug.fId ];
-    gcom.vfn   = ( * ug.vfn   )[ ug.fId ];
-    gcom.farea = ( * ug.farea )[ ug.fId ];
+    int fId = face.fId;
+    int lc  = face.lc;
+    int rc  = face.rc;
+    GCom & gcom = face.gcom;
+    VisGrad & visQ = face.visQ;
+    VisGrad & visT = face.visT;
+
+    gcom.xfn   = ( * ug.xfn   )[ fId ];
+    gcom.yfn   = ( * ug.yfn   )[ fId ];
+    gcom.zfn   = ( * ug.zfn   )[ fId ];
+    gcom.vfn   = ( * ug.vfn   )[ fId ];
+    gcom.farea = ( * ug.farea )[ fId ];
 
     gcom.CalcTangent();
 
     for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
     {
-        visQ.dqdx1[ iEqu ] = ( * unsf.dqdx )[ iEqu ][ ug.lc ];
-        visQ.dqdy1[ iEqu ] = ( * unsf.dqdy )[ iEqu ][ ug.lc ];
-        visQ.dqdz1[ iEqu ] = ( * unsf.dqdz )[ iEqu ][ ug.lc ];
+        visQ.dqdx1[ iEqu ] = ( * unsf.dqdx )[ iEqu ][ lc ];
+        visQ.dqdy1[ iEqu ] = ( * unsf.dqdy )[ iEqu ][ lc ];
+        visQ.dqdz1[ iEqu ] = ( * unsf.dqdz )[ iEqu ][ lc ];
 
-        visQ.dqdx2[ iEqu ] = ( * unsf.dqdx )[ iEqu ][ ug.rc ];
-        visQ.dqdy2[ iEqu ] = ( * unsf.dqdy )[ iEqu ][ ug.rc ];
-        visQ.dqdz2[ iEqu ] = ( * unsf.dqdz )[ iEqu ][ ug.rc ];
+        visQ.dqdx2[ iEqu ] = ( * unsf.dqdx )[ iEqu ][ rc ];
+        visQ.dqdy2[ iEqu ] = ( * unsf.dqdy )[ iEqu ][ rc ];
+        visQ.dqdz2[ iEqu ] = ( * unsf.dqdz )[ iEqu ][ rc ];
     }
 
     for ( int iEqu = 0; iEqu < nscom.nTModel; ++ iEqu )
     {
-        visT.dqdx1[ iEqu ] = ( * unsf.dtdx )[ iEqu ][ ug.lc ];
-        visT.dqdy1[ iEqu ] = ( * unsf.dtdy )[ iEqu ][ ug.lc ];
-        visT.dqdz1[ iEqu ] = ( * unsf.dtdz )[ iEqu ][ ug.lc ];
+        visT.dqdx1[ iEqu ] = ( * unsf.dtdx )[ iEqu ][ lc ];
+        visT.dqdy1[ iEqu ] = ( * unsf.dtdy )[ iEqu ][ lc ];
+        visT.dqdz1[ iEqu ] = ( * unsf.dtdz )[ iEqu ][ lc ];
 
-        visT.dqdx2[ iEqu ] = ( * unsf.dtdx )[ iEqu ][ ug.rc ];
-        visT.dqdy2[ iEqu ] = ( * unsf.dtdy )[ iEqu ][ ug.rc ];
-        visT.dqdz2[ iEqu ] = ( * unsf.dtdz )[ iEqu ][ ug.rc ];
+        visT.dqdx2[ iEqu ] = ( * unsf.dtdx )[ iEqu ][ rc ];
+        visT.dqdy2[ iEqu ] = ( * unsf.dtdy )[ iEqu ][ rc ];
+        visT.dqdz2[ iEqu ] = ( * unsf.dtdz )[ iEqu ][ rc ];
     }
 
-    nscom.visl1 = ( * unsf.visl )[ 0 ][ ug.lc ];
-    nscom.visl2 = ( * unsf.visl )[ 0 ][ ug.rc ];
+    face.visl1 = ( * unsf.visl )[ 0 ][ lc ];
+    face.visl2 = ( * unsf.visl )[ 0 ][ rc ];
 
-    nscom.vist1 = ( * unsf.vist )[ 0 ][ ug.lc ];
-    nscom.vist2 = ( * unsf.vist )[ 0 ][ ug.rc ];
+    face.vist1 = ( * unsf.vist )[ 0 ][ lc ];
+    face.vist2 = ( * unsf.vist )[ 0 ][ rc ];
 
-    nscom.visl = half * ( nscom.visl1 + nscom.visl2 );
-    nscom.vist = half * ( nscom.vist1 + nscom.vist2 );
-    nscom.vis  = nscom.visl + nscom.vist;
+    face.visl = half * ( face.visl1 + face.visl2 );
+    face.vist = half * ( face.vist1 + face.vist2 );
+    face.vism = face.visl + face.vist;
 
     for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
     {
-        visQ.q1[ iEqu ] = ( * unsf.q )[ iEqu ][ ug.lc ];
-        visQ.q2[ iEqu ] = ( * unsf.q )[ iEqu ][ ug.rc ];
+        visQ.q1[ iEqu ] = ( * unsf.q )[ iEqu ][ lc ];
+        visQ.q2[ iEqu ] = ( * unsf.q )[ iEqu ][ rc ];
     }
 
     for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
@@ -309,8 +376,8 @@ void UNsVisFlux::PrepareFaceValue()
 
     for ( int iEqu = 0; iEqu < nscom.nTModel; ++ iEqu )
     {
-        visT.q1[ iEqu ] = ( * unsf.tempr )[ iEqu ][ ug.lc ];
-        visT.q2[ iEqu ] = ( * unsf.tempr )[ iEqu ][ ug.rc ];
+        visT.q1[ iEqu ] = ( * unsf.tempr )[ iEqu ][ lc ];
+        visT.q2[ iEqu ] = ( * unsf.tempr )[ iEqu ][ rc ];
     }
 
     for ( int iEqu = 0; iEqu < nscom.nTModel; ++ iEqu )
@@ -319,16 +386,20 @@ void UNsVisFlux::PrepareFaceValue()
         visT.q22[ iEqu ] = visT.q2[ iEqu ];
     }
 
-    this->AverGrad();
-    this->CalcFaceWeight();
+    this->AverGrad( face );
+    this->CalcFaceWeight( face );
 
-    ( this->* visPointer )();
+    ( this->* visPointer )( face );
 
-    this->SaveFacePara();
+    this->SaveFacePara( face );
 }
 
-void UNsVisFlux::SaveFacePara()
+void UNsVisFlux::SaveFacePara( NsVisFace & face )
 {
+    NsVis & vis = face.vis;
+    VisGrad & visQ = face.visQ;
+    VisGrad & visT = face.visT;
+
     vis.dudx  = visQ.dqdx[ IDX::IU ];
     vis.dudy  = visQ.dqdy[ IDX::IU ];
     vis.dudz  = visQ.dqdz[ IDX::IU ];
@@ -349,93 +420,106 @@ void UNsVisFlux::SaveFacePara()
     vis.tmid = visT.q[ IDX::ITT ];
 }
 
-void UNsVisFlux::CalcFaceWeight()
+void UNsVisFlux::CalcFaceWeight( NsVisFace & face )
 {
-    vgg.CalcFaceWeight();
+    face.vgg.CalcFaceWeight( face.fId, face.lc, face.rc );
 }
 
-void UNsVisFlux::AverMethod()
+void UNsVisFlux::AverMethod( NsVisFace & face )
 {
-    this->ZeroNormalGrad();
+    this->ZeroNormalGrad( face );
 
-    this->AverFaceValue();
+    this->AverFaceValue( face );
 
-    this->AverGrad();
+    this->AverGrad( face );
 
-    this->CalcNormalGrad();
+    this->CalcNormalGrad( face );
 }
 
-void UNsVisFlux::StdMethod()
+void UNsVisFlux::StdMethod( NsVisFace & face )
 {
-    this->CalcGradCoef();
+    this->CalcGradCoef( face );
 
-    this->ZeroNormalGrad();
+    this->ZeroNormalGrad( face );
 
-    this->AverFaceValue();
+    this->AverFaceValue( face );
 
-    this->AverGrad();
+    this->AverGrad( face );
 
-    this->CorrectFaceGrad();
+    this->CorrectFaceGrad( face );
 
-    this->CalcNormalGrad();
+    this->CalcNormalGrad( face );
 }
 
-void UNsVisFlux::TestMethod()
+void UNsVisFlux::TestMethod( NsVisFace & face )
 {
-    this->ZeroNormalGrad();
+    this->ZeroNormalGrad( face );
 
-    this->AverFaceValue();
+    this->AverFaceValue( face );
 
-    this->PrepareCellGeom();
+    this->PrepareCellGeom( face );
 
-    this->CalcTestMethod();
+    this->CalcTestMethod( face );
 
-    this->ModifyFaceGrad();
+    this->ModifyFaceGrad( face );
 }
 
-void UNsVisFlux::New1Method()
+void UNsVisFlux::New1Method( NsVisFace & face )
 {
-    this->ZeroNormalGrad();
+    this->ZeroNormalGrad( face );
 
-    this->AccurateFaceValue();
+    this->AccurateFaceValue( face );
 
-    this->PrepareCellGeom();
+    this->PrepareCellGeom( face );
 
-    this->CalcNew1Method();
+    this->CalcNew1Method( face );
 
-    this->ModifyFaceGrad();
+    this->ModifyFaceGrad( face );
 }
 
-void UNsVisFlux::New2Method()
+void UNsVisFlux::New2Method( NsVisFace & face )
 {
-    this->ZeroNormalGrad();
+    this->ZeroNormalGrad( face );
 
-    this->AccurateFaceValue();
+    this->AccurateFaceValue( face );
 
-    this->PrepareCellGeom();
+    this->PrepareCellGeom( face );
 
-    this->CalcNew2Method();
+    this->CalcNew2Method( face );
 
-    this->ModifyFaceGrad();
+    this->ModifyFaceGrad( face );
 }
 
-void UNsVisFlux::CalcGradCoef()
+void UNsVisFlux::CalcGradCoef( NsVisFace & face )
 {
-    vgg.CalcGradCoef();
+    face.vgg.CalcGradCoef( face.lc, face.rc );
 }
 
 
-void UNsVisFlux::PrepareCellGeom()
+void UNsVisFlux::PrepareCellGeom( NsVisFace & face )
 {
-    vgg.PrepareCellGeom();
+    face.vgg.PrepareCellGeom( face.gcom, face.fId, face.lc, face.rc );
 }
 
-void UNsVisFlux::UpdateFaceVisFlux()
+void UNsVisFlux::UpdateFaceVisFlux( NsVisFace & face )
 {
-    Real coeff = - nscom.oreynolds * gcom.farea;
+    Real coeff = - nscom.oreynolds * face.gcom.farea;
+
+    if ( this->res )
+    {
+        for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
+        {
+            Real flux = coeff * face.vis.fvis[ iEqu ];
+            ( * res )[ iEqu ][ face.lc ] -= flux;
+            if ( face.fId < ug.nBFaces ) continue;
+            ( * res )[ iEqu ][ face.rc ] += flux;
+        }
+        return;
+    }
+
     for ( int iEqu = 0; iEqu < nscom.nTEqu; ++ iEqu )
     {
-        ( * visflux )[ iEqu ][ ug.fId ] = coeff * vis.fvis[ iEqu ];
+        ( * visflux )[ iEqu ][ face.fId ] = coeff * face.vis.fvis[ iEqu ];
     }
 }
 
@@ -37,6 +37,7 @@ License
 #include "DataBase.h"
 #include "FieldBase.h"
 #include "Iteration.h"
+#include "InterField.h"
 #include <iostream>
 
 
@@ -45,23 +46,23 @@ BeginNameSpace( ONEFLOW )
 void InitUnsField()
 {
     UnsGrid * grid = Zone::GetUnsGrid();
-    unsf.invsr = ONEFLOW::GetFieldPointer< MRField >( grid, "invsr" );
-    unsf.vissr = ONEFLOW::GetFieldPointer< MRField >( grid, "vissr" );
-    unsf.gama  = ONEFLOW::GetFieldPointer< MRField >( grid, "gama" );
-    unsf.q  = ONEFLOW::GetFieldPointer< MRField >( grid, "q" );
+    unsf.invsr = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.invsr );
+    unsf.vissr = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.vissr );
+    unsf.gama  = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.gama );
+    unsf.q  = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.q );
     //unsf.q1 = ONEFLOW::GetFieldPointer< MRField >( grid, "q1" );
     //unsf.q2 = ONEFLOW::GetFieldPointer< MRField >( grid, "q2" );
-    unsf.dq = ONEFLOW::GetFieldPointer< MRField >( grid, "dq" );
-    unsf.dqdx = ONEFLOW::GetFieldPointer< MRField >( grid, "dqdx" );
-    unsf.dqdy = ONEFLOW::GetFieldPointer< MRField >( grid, "dqdy" );
-    unsf.dqdz = ONEFLOW::GetFieldPointer< MRField >( grid, "dqdz" );
+    unsf.dq = ONEFLOW::GetFieldPointer< MCField >( grid, unsh.dq );
+    unsf.dqdx = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.dqdx );
+    unsf.dqdy = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.dqdy );
+    unsf.dqdz = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.dqdz );
 
-    unsf.visl = ONEFLOW::GetFieldPointer< MRField >( grid, "visl" );
-    unsf.vist = ONEFLOW::GetFieldPointer< MRField >( grid, "vist" );
+    unsf.visl = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.visl );
+    unsf.vist = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.vist );
     //unsf.timestep = ONEFLOW::GetFieldPointer< MRField >( grid, "timestep" );
-    unsf.res = ONEFLOW::GetFieldPointer< MRField >( grid, "res" );
-    unsf.res1 = ONEFLOW::GetFieldPointer< MRField >( grid, "res1" );
-    unsf.res2 = ONEFLOW::GetFieldPointer< MRField >( grid, "res2" );
+    unsf.res = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.res );
+    unsf.res1 = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.res1 );
+    unsf.res2 = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.res2 );
 
     //unsf.tempr = ONEFLOW::GetFieldPointer< MRField >( grid, "tempr" );
 }
@@ -189,6 +190,9 @@ void UTimeStep::ReadTmp()
 
 void UTimeStep::CalcTimeStep()
 {
+    //the spectral radii of the interface faces read the halo
+    ONEFLOW::FinishInterfaceData();
+
     this->Init();
 
     //ReadTmp();
@@ -258,7 +262,7 @@ void UTimeStep::CalcInvSpectrumField()
 {
     Grid * grid = Zone::GetGrid();
 
-    MRField * invsr = ONEFLOW::GetFieldPointer< MRField >( grid, "invsr" );
+    MRField * invsr = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.invsr );
 
     ONEFLOW::ZeroField( invsr, 1, grid->nCells );
 
@@ -278,7 +282,7 @@ void UTimeStep::CalcVisSpectrumField()
 {
     Grid * grid = Zone::GetGrid();
 
-    MRField * vissr = ONEFLOW::GetFieldPointer< MRField >( grid, "vissr" );
+    MRField * vissr = ONEFLOW::GetFieldPointer< MRField >( grid, unsh.vissr );
 
     ONEFLOW::ZeroField( vissr, 1, grid->nCells );
 
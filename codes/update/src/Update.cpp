@@ -70,7 +70,11 @@ void GetUpdateField( int sTid, FieldWrap *q, FieldWrap *dq )
         std::string & qFieldString  = solverInfo->implicitString[ 0 ];
         std::string & dQFieldString = solverInfo->implicitString[ 1 ];
         q  = FieldHome::GetFieldWrap( qFieldString  );
-        dq = FieldHome::GetFieldWrap( dQFieldString );
+        //a contiguous dq has no MRField rows to wrap
+        if ( solverInfo->GetFieldLayout( dQFieldString ) < 0 )
+        {
+            dq = FieldHome::GetFieldWrap( dQFieldString );
+        }
     }
     else if (TaskState::task->taskName == "UPDATE_FLOWFIELD_SIMPLE")
     {
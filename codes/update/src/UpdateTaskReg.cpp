@@ -23,6 +23,9 @@ License
 #include "UpdateTaskReg.h"
 #include "Update.h"
 #include "SolverState.h"
+#include "Task.h"
+#include "TaskState.h"
+#include "Lusgs.h"
 #include "TaskRegister.h"
 
 BeginNameSpace( ONEFLOW )
@@ -38,6 +41,13 @@ void UpdateFlowField( StringField & data )
     Update * update = CreateUpdate( sTid );
     update->UpdateFlowField( sTid );
     delete update;
+
+    //the implicit operator cached by the sweeps belongs to the old flow field
+    if ( TaskState::task->taskName == "UPDATE_FLOWFIELD_LUSGS" )
+    {
+        LusgsSolver * lusgsSolver = LusgsState::GetLusgsSolver();
+        if ( lusgsSolver ) lusgsSolver->ResetOperator();
+    }
 }
 
 void UpdateINsFlowField(StringField & data)
@@ -23,6 +23,7 @@ License
 
 #pragma once
 #include "HXDefine.h"
+#include "CsrLink.h"
 #include "HXArray.h"
 
 BeginNameSpace( ONEFLOW )
@@ -62,7 +63,16 @@ public:
     IntField * lcf;
     IntField * rcf;
     IntField * blankf;
-    LinkField * c2f;
+    CsrLink * c2f;
+
+    IntField * colorStart;
+    IntField * colorFaces;
+    IntField * lowerLevelStart;
+    IntField * lowerLevelCells;
+    IntField * upperLevelStart;
+    IntField * upperLevelCells;
+    IntField * innerFaces;
+    IntField * haloFaces;
 
     RealField * xfn;
     RealField * yfn;
@@ -88,6 +98,7 @@ public:
 extern UGeom ug;
 
 void AddF2CField( MRField * cellField, MRField * faceField );
+void AddF2CFieldGather( MRField * cellField, MRField * faceField );
 void AddF2CFieldDebug( MRField * cellField, MRField * faceField );
 
 class HXDebug
@@ -28,6 +28,9 @@ BeginNameSpace( ONEFLOW )
 
 void CalcGrad( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz );
 void CalcGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz );
+void CalcGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz, IntField & faces );
+void AddFaceGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz, int fId );
+void FinishGradGGCellWeight( RealField & dqdx, RealField & dqdy, RealField & dqdz );
 void CalcGradDebug( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz );
 void CalcGradGGCellWeightDebug( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz );
 
@@ -68,6 +68,11 @@ public:
     void CalcFaceValueWeighted();
     void GetQlQr();
     virtual void BcQlQrFix();
+public:
+    //the left and right states of one face, reconstructed without the qf1/qf2 face arrays
+    void CalcFaceQlQr( int fId, RealField & ql, RealField & qr );
+    void CalcFaceValue( int fId, int lc, int rc, RealField & ql, RealField & qr );
+    virtual bool BcQlQrFix( int fId, int lc, int rc, RealField & ql, RealField & qr );
 public:
     int nEqu;
     MRField * q;
@@ -29,6 +29,7 @@ License
 BeginNameSpace( ONEFLOW )
 
 class DataBook;
+class VtkFile;
 
 class VisualTool
 {
@@ -37,6 +38,7 @@ public:
     ~VisualTool();
 public:
     StringField title;
+    StringField varNames;
     HXVector< MRField * > qNodeField;
 public:
     void Init();
@@ -57,6 +59,7 @@ public:
     void ResolveElementEdge();
     void Dump( std::ostringstream & oss, VisualTool * visualTool, std::string & bcTitle );
     void DumpDebug( std::ostringstream & oss, VisualTool * visualTool, std::string & bcTitle );
+    void DumpVtk( VtkFile * vtkFile, VisualTool * visualTool );
     void DumpSeveralElement();
 public:
     LinkField f2n;
@@ -80,9 +83,15 @@ public:
     void ShowBc( std::ostringstream & oss, VisualTool * visualTool );
     void ShowBcDebugTest( std::ostringstream & oss, VisualTool * visualTool );
     void ExtractLinkNum( LinkField & f2n, IntField & fnNumber );
-    int  GetTotalNumFaceNodes( LinkField & f2n );
+    int  GetTotalNumFaceNodes( CsrLink & f2n );
+public:
+    void ShowVtk( std::ostringstream & oss, VisualTool * visualTool );
+    void DumpVtkField( VtkFile * vtkFile, VisualTool * visualTool );
+    void CalcCellPolygon( LinkField & cellEdges, IntField & polygon );
+    void WriteVtkPiece( VtkFile * vtkFile, const std::string & mainName, const std::string & pieceName, StringField & pieceNames, StringField & pieceFiles );
 };
 
+void AddVtkFields( VtkFile * vtkFile, VisualTool * visualTool );
 void CalcMach( MRField * r, MRField * u, MRField * v, MRField * w, MRField * p, MRField * gama, MRField * mach );
 
 EndNameSpace
@@ -31,6 +31,8 @@ const int VIS_TEST = 2;
 const int VIS_NEW1 = 3;
 const int VIS_NEW2 = 4;
 
+class GCom;
+
 class VisGradGeom
 {
 public:
@@ -38,9 +40,12 @@ public:
     ~VisGradGeom();
 public:
     void CalcFaceWeight();
+    void CalcFaceWeight( int fId, int lc, int rc );
     void CalcAngle( Real dx, Real dy, Real dz, Real dist, Real & angle );
     void PrepareCellGeom();
+    void PrepareCellGeom( GCom & gcom, int fId, int lc, int rc );
     void CalcGradCoef();
+    void CalcGradCoef( int lc, int rc );
 public:
     Real dxl, dyl, dzl;
     Real dxr, dyr, dzr;
@@ -85,6 +90,20 @@ public:
     void AccurateSideValue();
     void AccurateFaceValue();
     void ModifyFaceGrad();
+public:
+    //the same operations on an explicit face geometry, used by the threaded face loops
+    void CorrectFaceGrad( VisGradGeom & vgg );
+    void CalcNormalGrad( GCom & gcom );
+    void CalcTestMethod( VisGradGeom & vgg, int fId );
+    void CalcNew1Method( VisGradGeom & vgg );
+    void CalcNew2Method( VisGradGeom & vgg );
+    bool FaceAngleIsValid( VisGradGeom & vgg );
+    bool TestSatisfied( VisGradGeom & vgg, int fId );
+    bool New1Satisfied( VisGradGeom & vgg );
+    bool New2Satisfied( VisGradGeom & vgg );
+    void CalcC1C2( VisGradGeom & vgg, int fId );
+    void AccurateSideValue( VisGradGeom & vgg );
+    void ModifyFaceGrad( VisGradGeom & vgg, GCom & gcom );
 public:
     RealField q, q1, q2;
     RealField q11, q22;
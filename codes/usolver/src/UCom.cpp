@@ -34,6 +34,7 @@ License
 #include "OStream.h"
 #include "HXMath.h"
 #include "FileUtil.h"
+#include "Ctrl.h"
 #include <iostream>
 
 BeginNameSpace( ONEFLOW )
@@ -99,6 +100,32 @@ void UGeom::Init()
 
     ug.c2f = & cellTopo->c2f;
 
+    if ( ctrl.nthreads > 1 && ctrl.fusef2c == 1 )
+    {
+        faceTopo->CalcFaceColor( cellTopo->c2f );
+    }
+
+    ug.colorStart = & faceTopo->colorStart;
+    ug.colorFaces = & faceTopo->colorFaces;
+
+    if ( ctrl.nthreads > 1 && ctrl.lusgslevel == 1 )
+    {
+        faceTopo->CalcSweepLevel( cellTopo->c2f );
+    }
+
+    ug.lowerLevelStart = & faceTopo->lowerLevelStart;
+    ug.lowerLevelCells = & faceTopo->lowerLevelCells;
+    ug.upperLevelStart = & faceTopo->upperLevelStart;
+    ug.upperLevelCells = & faceTopo->upperLevelCells;
+
+    if ( ctrl.overlapcomm == 1 )
+    {
+        faceTopo->CalcHaloFace();
+    }
+
+    ug.innerFaces = & faceTopo->innerFaces;
+    ug.haloFaces  = & faceTopo->haloFaces;
+
     //ug.ireconface = 0;
     ug.ireconface = 1;
 }
@@ -143,6 +170,12 @@ void UGeom::DumpCellFace( int cId )
 
 void AddF2CField( MRField * cellField, MRField * faceField )
 {
+    if ( ctrl.nthreads > 1 )
+    {
+        ONEFLOW::AddF2CFieldGather( cellField, faceField );
+        return;
+    }
+
     int nEqu = cellField->GetNEqu();
     for ( int fId = 0; fId < ug.nBFaces; ++ fId )
     {
@@ -170,6 +203,40 @@ void AddF2CField( MRField * cellField, MRField * faceField )
     }
 }
 
+void AddF2CFieldGather( MRField * cellField, MRField * faceField )
+{
+    //every cell gathers its own faces, c2f lists them in ascending face order,
+    //so the sums are the same as the face scatter above and no cell is written twice
+    int nEqu = cellField->GetNEqu();
+
+#pragma omp parallel for num_threads( ctrl.nthreads )
+    for ( int cId = 0; cId < ug.nCells; ++ cId )
+    {
+        CsrRow faces = ( * ug.c2f )[ cId ];
+        int nFaces = faces.size();
+
+        for ( int iFace = 0; iFace < nFaces; ++ iFace )
+        {
+            int fId = faces[ iFace ];
+
+            if ( ( * ug.lcf )[ fId ] == cId )
+            {
+                for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+                {
+                    ( * cellField )[ iEqu ][ cId ] -= ( * faceField )[ iEqu ][ fId ];
+                }
+            }
+            else
+            {
+                for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
+                {
+                    ( * cellField )[ iEqu ][ cId ] += ( * faceField )[ iEqu ][ fId ];
+                }
+            }
+        }
+    }
+}
+
 void AddF2CFieldDebug( MRField * cellField, MRField * faceField )
 {
     int nEqu = cellField->GetNEqu();
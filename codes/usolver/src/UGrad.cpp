@@ -93,41 +93,60 @@ void CalcGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, Re
 
     for ( int fId = 0; fId < ug.nFaces; ++ fId )
     {
-        ug.fId = fId;
-        ug.lc = ( * ug.lcf )[ ug.fId ];
-        ug.rc = ( * ug.rcf )[ ug.fId ];
+        ONEFLOW::AddFaceGradGGCellWeight( q, dqdx, dqdy, dqdz, fId );
+    }
 
-        Real dxl = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.lc ];
-        Real dyl = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.lc ];
-        Real dzl = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.lc ];
+    ONEFLOW::FinishGradGGCellWeight( dqdx, dqdy, dqdz );
+}
 
-        Real dxr = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.rc ];
-        Real dyr = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.rc ];
-        Real dzr = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.rc ];
+void CalcGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz, IntField & faces )
+{
+    int nFaces = faces.size();
+    for ( int i = 0; i < nFaces; ++ i )
+    {
+        ONEFLOW::AddFaceGradGGCellWeight( q, dqdx, dqdy, dqdz, faces[ i ] );
+    }
+}
 
-        Real delt1  = DIST( dxl, dyl, dzl );
-        Real delt2  = DIST( dxr, dyr, dzr );
-        Real delta  = 1.0 / ( delt1 + delt2 + SMALL );
+void AddFaceGradGGCellWeight( RealField & q, RealField & dqdx, RealField & dqdy, RealField & dqdz, int fId )
+{
+    ug.fId = fId;
+    ug.lc = ( * ug.lcf )[ ug.fId ];
+    ug.rc = ( * ug.rcf )[ ug.fId ];
 
-        Real cl = delt2 * delta;
-        Real cr = delt1 * delta;
+    Real dxl = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.lc ];
+    Real dyl = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.lc ];
+    Real dzl = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.lc ];
 
-        Real value = cl * q[ ug.lc ] + cr * q[ ug.rc ];
+    Real dxr = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.rc ];
+    Real dyr = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.rc ];
+    Real dzr = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.rc ];
 
-        Real fnxa = ( * ug.xfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
-        Real fnya = ( * ug.yfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
-        Real fnza = ( * ug.zfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
+    Real delt1  = DIST( dxl, dyl, dzl );
+    Real delt2  = DIST( dxr, dyr, dzr );
+    Real delta  = 1.0 / ( delt1 + delt2 + SMALL );
 
-        dqdx[ ug.lc ] += fnxa * value;
-        dqdy[ ug.lc ] += fnya * value;
-        dqdz[ ug.lc ] += fnza * value;
+    Real cl = delt2 * delta;
+    Real cr = delt1 * delta;
 
-        if ( ug.fId < ug.nBFaces ) continue;
-        dqdx[ ug.rc ] -= fnxa * value;
-        dqdy[ ug.rc ] -= fnya * value;
-        dqdz[ ug.rc ] -= fnza * value;
-    }
+    Real value = cl * q[ ug.lc ] + cr * q[ ug.rc ];
+
+    Real fnxa = ( * ug.xfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
+    Real fnya = ( * ug.yfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
+    Real fnza = ( * ug.zfn )[ ug.fId ] * ( * ug.farea )[ ug.fId ];
 
+    dqdx[ ug.lc ] += fnxa * value;
+    dqdy[ ug.lc ] += fnya * value;
+    dqdz[ ug.lc ] += fnza * value;
+
+    if ( ug.fId < ug.nBFaces ) return;
+    dqdx[ ug.rc ] -= fnxa * value;
+    dqdy[ ug.rc ] -= fnya * value;
+    dqdz[ ug.rc ] -= fnza * value;
+}
+
+void FinishGradGGCellWeight( RealField & dqdx, RealField & dqdy, RealField & dqdz )
+{
     for ( int cId = 0; cId < ug.nCells; ++ cId )
     {
         Real ovol = one / ( * ug.cvol )[ cId ];
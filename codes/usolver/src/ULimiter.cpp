@@ -255,6 +255,95 @@ void LimField::CalcFaceValue()
     }
 }
 
+void LimField::CalcFaceQlQr( int fId, RealField & ql, RealField & qr )
+{
+    int lc = ( * ug.lcf )[ fId ];
+    int rc = ( * ug.rcf )[ fId ];
+
+    if ( this->BcQlQrFix( fId, lc, rc, ql, qr ) ) return;
+
+    for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+    {
+        ql[ iEqu ] = ( * this->q )[ iEqu ][ lc ];
+        qr[ iEqu ] = ( * this->q )[ iEqu ][ rc ];
+    }
+
+    this->CalcFaceValue( fId, lc, rc, ql, qr );
+}
+
+bool LimField::BcQlQrFix( int fId, int lc, int rc, RealField & ql, RealField & qr )
+{
+    if ( fId >= ug.nBFaces ) return false;
+
+    int bcType = ug.bcRecord->bcType[ fId ];
+    if ( bcType == BC::INTERFACE ) return false;
+    if ( bcType == BC::PERIODIC  ) return false;
+
+    for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+    {
+        Real tmp = half * ( ( * this->q )[ iEqu ][ lc ] + ( * this->q )[ iEqu ][ rc ] );
+
+        ql[ iEqu ] = tmp;
+        qr[ iEqu ] = tmp;
+    }
+
+    return true;
+}
+
+void LimField::CalcFaceValue( int fId, int lc, int rc, RealField & ql, RealField & qr )
+{
+    //ql and qr hold the cell values on entry, a rejected reconstruction falls back to them
+    Real dx = ( * ug.xfc )[ fId ] - ( * ug.xcc )[ lc ];
+    Real dy = ( * ug.yfc )[ fId ] - ( * ug.ycc )[ lc ];
+    Real dz = ( * ug.zfc )[ fId ] - ( * ug.zcc )[ lc ];
+
+    for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+    {
+        Real dqdx = ( * this->dqdx )[ iEqu ][ lc ];
+        Real dqdy = ( * this->dqdy )[ iEqu ][ lc ];
+        Real dqdz = ( * this->dqdz )[ iEqu ][ lc ];
+
+        Real phil = ( * this->limiter )[ iEqu ][ lc ];
+        Real phir = ( * this->limiter )[ iEqu ][ rc ];
+        Real phi = this->ModifyLimiter( phil, phir );
+
+        ql[ iEqu ] += phi * ( dqdx * dx + dqdy * dy + dqdz * dz );
+    }
+
+    if ( ! ( * this->ckfun )( ql ) )
+    {
+        for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+        {
+            ql[ iEqu ] = ( * this->q )[ iEqu ][ lc ];
+        }
+    }
+
+    dx = ( * ug.xfc )[ fId ] - ( * ug.xcc )[ rc ];
+    dy = ( * ug.yfc )[ fId ] - ( * ug.ycc )[ rc ];
+    dz = ( * ug.zfc )[ fId ] - ( * ug.zcc )[ rc ];
+
+    for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+    {
+        Real dqdx = ( * this->dqdx )[ iEqu ][ rc ];
+        Real dqdy = ( * this->dqdy )[ iEqu ][ rc ];
+        Real dqdz = ( * this->dqdz )[ iEqu ][ rc ];
+
+        Real phil = ( * this->limiter )[ iEqu ][ lc ];
+        Real phir = ( * this->limiter )[ iEqu ][ rc ];
+        Real phi = this->ModifyLimiter( phir, phil );
+
+        qr[ iEqu ] += phi * ( dqdx * dx + dqdy * dy + dqdz * dz );
+    }
+
+    if ( ! ( * this->ckfun )( qr ) )
+    {
+        for ( int iEqu = 0; iEqu < this->nEqu; ++ iEqu )
+        {
+            qr[ iEqu ] = ( * this->q )[ iEqu ][ rc ];
+        }
+    }
+}
+
 void LimField::CalcFaceValueWeighted()
 {
     RealField qTry( this->nEqu );
@@ -39,6 +39,12 @@ License
 #include "HXMid.h"
 #include "NodeMesh.h"
 #include "NsCtrl.h"
+#include "Ctrl.h"
+#include "VtkFile.h"
+#include "FileUtil.h"
+#include "Task.h"
+#include "TaskState.h"
+#include "FileInfo.h"
 #include <sstream>
 #include <iostream>
 #include <algorithm>
@@ -73,6 +79,7 @@ void VisualTool::Init()
 
 void VisualTool::AddTitle( const std::string & varName )
 {
+    varNames.push_back( varName );
     title.push_back( AddString( "\"",  varName, "\"" ) );
 }
 
@@ -196,7 +203,7 @@ void BcVisual::Calcf2n( int bcType )
 {
     UnsGrid * grid = Zone::GetUnsGrid();
     FaceTopo * faceTopo = grid->faceTopo;
-    LinkField & f2n = faceTopo->faces;
+    CsrLink & f2n = faceTopo->faces;
     BcRecord * bcRecord = faceTopo->bcManager->bcRecord;
 
     IntField localf2n( 4 );
@@ -307,6 +314,21 @@ void BcVisual::Dump( std::ostringstream & oss, VisualTool * visualTool, std::str
        
 }
 
+void BcVisual::DumpVtk( VtkFile * vtkFile, VisualTool * visualTool )
+{
+    UnsGrid * grid = Zone::GetUnsGrid();
+
+    vtkFile->SetPoints( grid->nodeMesh->xN, grid->nodeMesh->yN, grid->nodeMesh->zN, & l2g );
+
+    AddVtkFields( vtkFile, visualTool );
+
+    int nElem = this->f2n.size();
+    for ( int iElem = 0; iElem < nElem; ++ iElem )
+    {
+        vtkFile->AddPolygon( this->f2n[ iElem ] );
+    }
+}
+
 void BcVisual::DumpDebug( std::ostringstream & oss, VisualTool * visualTool, std::string & bcTitle )
 {
     UnsGrid * grid = Zone::GetUnsGrid();
@@ -471,6 +493,13 @@ void UVisualize::Visual()
 
     std::ostringstream oss;
 
+    if ( ctrl.visualformat == 1 )
+    {
+        this->ShowVtk( oss, & visualTool );
+        ToDataBook( ActionState::dataBook, oss );
+        return;
+    }
+
     this->ShowBc( oss, & visualTool );
     //this->ShowBcDebug( oss, & visualTool );
     //this->ShowBcDebugTest( oss, & visualTool );
@@ -494,15 +523,9 @@ void UVisualize::ExtractLinkNum( LinkField & f2n, IntField & fnNumber )
     }
 }
 
-int UVisualize::GetTotalNumFaceNodes( LinkField & f2n )
+int UVisualize::GetTotalNumFaceNodes( CsrLink & f2n )
 {
-    int totalNumFaceNodes = 0;
-    int nSize = f2n.size();
-    for ( int i = 0; i < nSize; ++ i )
-    {
-        totalNumFaceNodes += f2n[ i ].size();
-    }
-    return totalNumFaceNodes;
+    return f2n.data.size();
 }
 
 void UVisualize::ShowField( std::ostringstream & oss, VisualTool * visualTool )
@@ -510,7 +533,7 @@ void UVisualize::ShowField( std::ostringstream & oss, VisualTool * visualTool )
     UnsGrid * grid = Zone::GetUnsGrid();
 
     FaceTopo * faceTopo = grid->faceTopo;
-    LinkField & f2n = faceTopo->faces;
+    CsrLink & f2n = faceTopo->faces;
 
     int nNodes = grid->nNodes;
     int nCells = grid->nCells;
@@ -586,6 +609,170 @@ void UVisualize::ShowBc( std::ostringstream & oss, VisualTool * visualTool )
     }    
 }
 
+void UVisualize::ShowVtk( std::ostringstream & oss, VisualTool * visualTool )
+{
+    //every zone writes its own binary pieces, only the index entries travel to the server
+    std::string mainName, extensionName;
+    ONEFLOW::GetFileNameExtension( TaskState::task->fileInfo->fileName, mainName, extensionName, "." );
+
+    StringField pieceNames;
+    StringField pieceFiles;
+
+    if ( ! IsTwoD() )
+    {
+        UnsGrid * grid = Zone::GetUnsGrid();
+
+        IntField bcTypeList;
+        grid->faceTopo->bcManager->CalcBcType( bcTypeList );
+        int nBcType = bcTypeList.size();
+
+        for ( int iBcType = 0; iBcType < nBcType; ++ iBcType )
+        {
+            int bcType = bcTypeList[ iBcType ];
+
+            if ( BC::IsInterfaceBc( bcType ) ) continue;
+
+            BcVisual bcVisual;
+
+            bcVisual.Calc( bcType );
+
+            VtkFile vtkFile;
+            bcVisual.DumpVtk( & vtkFile, visualTool );
+
+            this->WriteVtkPiece( & vtkFile, mainName, AddString( "bc", bcType ), pieceNames, pieceFiles );
+        }
+    }
+
+    if ( this->NeedVisualField() )
+    {
+        VtkFile vtkFile;
+        this->DumpVtkField( & vtkFile, visualTool );
+
+        this->WriteVtkPiece( & vtkFile, mainName, "field", pieceNames, pieceFiles );
+    }
+
+    //the server appends the entries in zone order, so the first and last zones close the index
+    if ( ZoneState::zid == 0 )
+    {
+        VtkFile::DumpIndexHeader( oss );
+    }
+
+    VtkFile::DumpIndexBlock( oss, ZoneState::zid, pieceNames, pieceFiles );
+
+    if ( ZoneState::zid == ZoneState::nZones - 1 )
+    {
+        VtkFile::DumpIndexFooter( oss );
+    }
+}
+
+void UVisualize::WriteVtkPiece( VtkFile * vtkFile, const std::string & mainName, const std::string & pieceName, StringField & pieceNames, StringField & pieceFiles )
+{
+    std::string fileName = AddString( mainName, "_z", ZoneState::zid, "_" ) + pieceName + ".vtu";
+
+    std::fstream file;
+    Prj::OpenPrjFile( file, fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+    vtkFile->Write( file );
+    Prj::CloseFile( file );
+
+    //the index refers to its pieces relative to its own directory
+    std::basic_string< char >::size_type index = fileName.find_last_of( "/\\" );
+    if ( index != std::string::npos )
+    {
+        fileName = fileName.substr( index + 1 );
+    }
+
+    pieceNames.push_back( pieceName );
+    pieceFiles.push_back( fileName );
+}
+
+void UVisualize::DumpVtkField( VtkFile * vtkFile, VisualTool * visualTool )
+{
+    UnsGrid * grid = Zone::GetUnsGrid();
+
+    FaceTopo * faceTopo = grid->faceTopo;
+    CsrLink & f2n = faceTopo->faces;
+    IntField & lCells = faceTopo->lCells;
+    IntField & rCells = faceTopo->rCells;
+
+    int nCells = grid->nCells;
+    int nFaces = grid->nFaces;
+
+    vtkFile->SetPoints( grid->nodeMesh->xN, grid->nodeMesh->yN, grid->nodeMesh->zN );
+
+    AddVtkFields( vtkFile, visualTool );
+
+    //faces of each cell, a right cell refers to its face as -( fId + 1 ) and sees it reversed
+    LinkField c2f( nCells );
+    for ( int fId = 0; fId < nFaces; ++ fId )
+    {
+        int lc = lCells[ fId ];
+        int rc = rCells[ fId ];
+        if ( lc >= 0 && lc < nCells ) c2f[ lc ].push_back( fId );
+        if ( rc >= 0 && rc < nCells ) c2f[ rc ].push_back( - fId - 1 );
+    }
+
+    LinkField cellFaces;
+    IntField polygon;
+
+    for ( int cId = 0; cId < nCells; ++ cId )
+    {
+        int nCellFaces = c2f[ cId ].size();
+        cellFaces.resize( nCellFaces );
+        for ( int iFace = 0; iFace < nCellFaces; ++ iFace )
+        {
+            int id = c2f[ cId ][ iFace ];
+            int fId = id >= 0 ? id : - id - 1;
+            CsrRow faceNodes = f2n[ fId ];
+            cellFaces[ iFace ].assign( faceNodes.begin(), faceNodes.end() );
+            if ( id < 0 )
+            {
+                std::reverse( cellFaces[ iFace ].begin(), cellFaces[ iFace ].end() );
+            }
+        }
+
+        if ( Dim::dimension == THREE_D )
+        {
+            vtkFile->AddPolyhedron( cellFaces );
+        }
+        else
+        {
+            this->CalcCellPolygon( cellFaces, polygon );
+            vtkFile->AddPolygon( polygon );
+        }
+    }
+}
+
+void UVisualize::CalcCellPolygon( LinkField & cellEdges, IntField & polygon )
+{
+    //chain the oriented edges of a two dimensional cell into its node loop
+    polygon.resize( 0 );
+
+    int nEdges = cellEdges.size();
+    if ( nEdges == 0 ) return;
+
+    int start = cellEdges[ 0 ][ 0 ];
+    int next  = cellEdges[ 0 ][ 1 ];
+    polygon.push_back( start );
+
+    for ( int iCount = 1; iCount < nEdges; ++ iCount )
+    {
+        if ( next == start ) break;
+        polygon.push_back( next );
+
+        bool found = false;
+        for ( int iEdge = 0; iEdge < nEdges; ++ iEdge )
+        {
+            if ( cellEdges[ iEdge ][ 0 ] == next )
+            {
+                next  = cellEdges[ iEdge ][ 1 ];
+                found = true;
+                break;
+            }
+        }
+        if ( ! found ) break;
+    }
+}
+
 void UVisualize::ShowBcDebugTest( std::ostringstream & oss, VisualTool * visualTool )
 {
     if ( IsTwoD() ) return;
@@ -638,6 +825,16 @@ void UVisualize::CalcNodeField( VisualTool * visualTool )
     }
 }
 
+void AddVtkFields( VtkFile * vtkFile, VisualTool * visualTool )
+{
+    int nVar = visualTool->qNodeField.size();
+    for ( int iVar = 0; iVar < nVar; ++ iVar )
+    {
+        RealField & q = ( * visualTool->qNodeField[ iVar ] )[ 0 ];
+        vtkFile->AddPointField( q, visualTool->varNames[ iVar ] );
+    }
+}
+
 void CalcMach( MRField * r, MRField * u, MRField * v, MRField * w, MRField * p, MRField * gama, MRField * mach )
 {
     UnsGrid * grid = Zone::GetUnsGrid();
@@ -43,13 +43,18 @@ VisGradGeom::~VisGradGeom()
 
 void VisGradGeom::CalcFaceWeight()
 {
-    dxl = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.lc ];
-    dyl = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.lc ];
-    dzl = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.lc ];
+    this->CalcFaceWeight( ug.fId, ug.lc, ug.rc );
+}
+
+void VisGradGeom::CalcFaceWeight( int fId, int lc, int rc )
+{
+    dxl = ( * ug.xfc )[ fId ] - ( * ug.xcc )[ lc ];
+    dyl = ( * ug.yfc )[ fId ] - ( * ug.ycc )[ lc ];
+    dzl = ( * ug.zfc )[ fId ] - ( * ug.zcc )[ lc ];
 
-    dxr = ( * ug.xfc )[ ug.fId ] - ( * ug.xcc )[ ug.rc ];
-    dyr = ( * ug.yfc )[ ug.fId ] - ( * ug.ycc )[ ug.rc ];
-    dzr = ( * ug.zfc )[ ug.fId ] - ( * ug.zcc )[ ug.rc ];
+    dxr = ( * ug.xfc )[ fId ] - ( * ug.xcc )[ rc ];
+    dyr = ( * ug.yfc )[ fId ] - ( * ug.ycc )[ rc ];
+    dzr = ( * ug.zfc )[ fId ] - ( * ug.zcc )[ rc ];
 
     delt1 = DIST( dxl, dyl, dzl );
     delt2 = DIST( dxr, dyr, dzr );
@@ -69,13 +74,18 @@ void VisGradGeom::CalcAngle( Real dx, Real dy, Real dz, Real dist, Real & angle
 
 void VisGradGeom::PrepareCellGeom()
 {
-    this->dxl = ( * ug.xcc )[ ug.lc ] - ( * ug.xfc )[ ug.fId ];
-    this->dyl = ( * ug.ycc )[ ug.lc ] - ( * ug.yfc )[ ug.fId ];
-    this->dzl = ( * ug.zcc )[ ug.lc ] - ( * ug.zfc )[ ug.fId ];
+    this->PrepareCellGeom( gcom, ug.fId, ug.lc, ug.rc );
+}
+
+void VisGradGeom::PrepareCellGeom( GCom & gcom, int fId, int lc, int rc )
+{
+    this->dxl = ( * ug.xcc )[ lc ] - ( * ug.xfc )[ fId ];
+    this->dyl = ( * ug.ycc )[ lc ] - ( * ug.yfc )[ fId ];
+    this->dzl = ( * ug.zcc )[ lc ] - ( * ug.zfc )[ fId ];
 
-    this->dxr = ( * ug.xcc )[ ug.rc ] - ( * ug.xfc )[ ug.fId ];
-    this->dyr = ( * ug.ycc )[ ug.rc ] - ( * ug.yfc )[ ug.fId ];
-    this->dzr = ( * ug.zcc )[ ug.rc ] - ( * ug.zfc )[ ug.fId ];
+    this->dxr = ( * ug.xcc )[ rc ] - ( * ug.xfc )[ fId ];
+    this->dyr = ( * ug.ycc )[ rc ] - ( * ug.yfc )[ fId ];
+    this->dzr = ( * ug.zcc )[ rc ] - ( * ug.zfc )[ fId ];
 
     this->d1  = gcom.xfn * this->dxl + gcom.yfn * this->dyl + gcom.zfn * this->dzl;
     this->d2  = gcom.xfn * this->dxr + gcom.yfn * this->dyr + gcom.zfn * this->dzr;
@@ -98,9 +108,14 @@ void VisGradGeom::PrepareCellGeom()
 
 void VisGradGeom::CalcGradCoef()
 {
-    this->dx  = ( * ug.xcc )[ ug.rc ] - ( * ug.xcc )[ ug.lc ];
-    this->dy  = ( * ug.ycc )[ ug.rc ] - ( * ug.ycc )[ ug.lc ];
-    this->dz  = ( * ug.zcc )[ ug.rc ] - ( * ug.zcc )[ ug.lc ];
+    this->CalcGradCoef( ug.lc, ug.rc );
+}
+
+void VisGradGeom::CalcGradCoef( int lc, int rc )
+{
+    this->dx  = ( * ug.xcc )[ rc ] - ( * ug.xcc )[ lc ];
+    this->dy  = ( * ug.ycc )[ rc ] - ( * ug.ycc )[ lc ];
+    this->dz  = ( * ug.zcc )[ rc ] - ( * ug.zcc )[ lc ];
 
     this->ods = 1.0 / DIST( this->dx, this->dy, this->dz );
 
@@ -177,6 +192,11 @@ void VisGrad::AverFaceValue()
 }
 
 void VisGrad::CorrectFaceGrad()
+{
+    this->CorrectFaceGrad( vgg );
+}
+
+void VisGrad::CorrectFaceGrad( VisGradGeom & vgg )
 {
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -185,6 +205,11 @@ void VisGrad::CorrectFaceGrad()
 }
 
 void VisGrad::CalcNormalGrad()
+{
+    this->CalcNormalGrad( gcom );
+}
+
+void VisGrad::CalcNormalGrad( GCom & gcom )
 {
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -193,6 +218,11 @@ void VisGrad::CalcNormalGrad()
 }
 
 bool VisGrad::FaceAngleIsValid()
+{
+    return this->FaceAngleIsValid( vgg );
+}
+
+bool VisGrad::FaceAngleIsValid( VisGradGeom & vgg )
 {
     // Theoretically, more accurate to include the following terms
     bool result =  vgg.angle1 > vgg.skewAngle && vgg.angle2 > vgg.skewAngle;
@@ -200,16 +230,26 @@ bool VisGrad::FaceAngleIsValid()
 }
 
 bool VisGrad::TestSatisfied()
+{
+    return this->TestSatisfied( vgg, ug.fId );
+}
+
+bool VisGrad::TestSatisfied( VisGradGeom & vgg, int fId )
 {
     bool result = vgg.angle1 > 0.0 && vgg.angle2 > 0.0 && ABS( vgg.d1 ) > SMALL && ABS( vgg.d2 ) > SMALL;
     if ( result )
     {
-        this->CalcC1C2();
+        this->CalcC1C2( vgg, fId );
     }
     return result;
 }
 
 bool VisGrad::New1Satisfied()
+{
+    return this->New1Satisfied( vgg );
+}
+
+bool VisGrad::New1Satisfied( VisGradGeom & vgg )
 {
     bool result =  vgg.d1 * vgg.d2 < 0.0 && ABS( vgg.d1 ) > SMALL && ABS( vgg.d2 ) > SMALL;
     if ( result )
@@ -222,6 +262,11 @@ bool VisGrad::New1Satisfied()
 }
 
 bool VisGrad::New2Satisfied()
+{
+    return this->New2Satisfied( vgg );
+}
+
+bool VisGrad::New2Satisfied( VisGradGeom & vgg )
 {
     vgg.d = - two *  vgg.d1 *  vgg.d2 / ( SQR(  vgg.d1,  vgg.d2 ) + SMALL );
 
@@ -231,14 +276,19 @@ bool VisGrad::New2Satisfied()
 }
 
 void VisGrad::CalcC1C2()
+{
+    this->CalcC1C2( vgg, ug.fId );
+}
+
+void VisGrad::CalcC1C2( VisGradGeom & vgg, int fId )
 {
     Real dtmp = SQR( vgg.d1, vgg.d2 );
     vgg.c1 = SQR( vgg.d1 ) / dtmp;
     vgg.c2 = 1.0 - vgg.c1;
 
-    if ( ug.fId < ug.nBFaces )
+    if ( fId < ug.nBFaces )
     {
-        int bcType = ug.bcRecord->bcType[ ug.fId ];
+        int bcType = ug.bcRecord->bcType[ fId ];
 
         if ( bcType != BC::INTERFACE )
         {
@@ -249,6 +299,11 @@ void VisGrad::CalcC1C2()
 }
 
 void VisGrad::AccurateSideValue()
+{
+    this->AccurateSideValue( vgg );
+}
+
+void VisGrad::AccurateSideValue( VisGradGeom & vgg )
 {
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -266,6 +321,11 @@ void VisGrad::AccurateFaceValue()
 }
 
 void VisGrad::ModifyFaceGrad()
+{
+    this->ModifyFaceGrad( vgg, gcom );
+}
+
+void VisGrad::ModifyFaceGrad( VisGradGeom & vgg, GCom & gcom )
 {
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -290,13 +350,18 @@ void VisGrad::ModifyFaceGrad()
 
 void VisGrad::CalcTestMethod()
 {
-    if ( this->FaceAngleIsValid() )
+    this->CalcTestMethod( vgg, ug.fId );
+}
+
+void VisGrad::CalcTestMethod( VisGradGeom & vgg, int fId )
+{
+    if ( this->FaceAngleIsValid( vgg ) )
     {
-        this->AccurateSideValue();
+        this->AccurateSideValue( vgg );
         this->AccurateFaceValue();
     }
 
-    if ( ! this->TestSatisfied() ) return;
+    if ( ! this->TestSatisfied( vgg, fId ) ) return;
 
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -316,9 +381,14 @@ void VisGrad::CalcTestMethod()
 
 void VisGrad::CalcNew1Method()
 {
-    if ( ! this->New1Satisfied() ) return;
+    this->CalcNew1Method( vgg );
+}
 
-    this->AccurateSideValue();
+void VisGrad::CalcNew1Method( VisGradGeom & vgg )
+{
+    if ( ! this->New1Satisfied( vgg ) ) return;
+
+    this->AccurateSideValue( vgg );
 
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -328,10 +398,15 @@ void VisGrad::CalcNew1Method()
 
 void VisGrad::CalcNew2Method()
 {
-    if ( ! this->New2Satisfied() ) return;
+    this->CalcNew2Method( vgg );
+}
+
+void VisGrad::CalcNew2Method( VisGradGeom & vgg )
+{
+    if ( ! this->New2Satisfied( vgg ) ) return;
 
     // Theoretically, more accurate to include the following terms
-    this->AccurateSideValue();
+    this->AccurateSideValue( vgg );
 
     for ( int iEqu = 0; iEqu < nEqu; ++ iEqu )
     {
@@ -24,6 +24,7 @@ License
 #pragma once
 #include "HXDefine.h"
 #include "HXArray.h"
+#include "CsrLink.h"
 #include <sstream>
 
 
@@ -50,6 +51,8 @@ public:
     static void DumpField( IntField & l2g, RealField & x );
     static void DumpFaceNodeNumber( LinkField & f2n );
     static void DumpFaceNodeLink( LinkField & f2n );
+    static void DumpFaceNodeNumber( CsrLink & f2n );
+    static void DumpFaceNodeLink( CsrLink & f2n );
     static void DumpFaceElementLink( IntField & elementId, int nElem );
 };
 
@@ -0,0 +1,60 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#pragma once
+#include "HXDefine.h"
+#include "HXArray.h"
+#include <sstream>
+#include <fstream>
+
+
+BeginNameSpace( ONEFLOW )
+
+//one binary VTK XML unstructured grid piece, the arrays are stored raw in the appended section
+class VtkFile
+{
+public:
+    VtkFile();
+    ~VtkFile();
+public:
+    RealField points;
+    IntField connectivity;
+    IntField offsets;
+    HXVector< unsigned char > types;
+    IntField faces;
+    IntField faceOffsets;
+    IntField * l2g;
+    StringField varNames;
+    HXVector< RealField * > varFields;
+public:
+    void SetPoints( RealField & x, RealField & y, RealField & z, IntField * l2g = 0 );
+    void AddPolygon( IntField & nodes );
+    void AddPolyhedron( LinkField & cellFaces );
+    void AddPointField( RealField & q, const std::string & varName );
+    void Write( std::fstream & file );
+public:
+    static void DumpIndexHeader( std::ostringstream & oss );
+    static void DumpIndexBlock( std::ostringstream & oss, int blockId, StringField & pieceNames, StringField & pieceFiles );
+    static void DumpIndexFooter( std::ostringstream & oss );
+};
+
+EndNameSpace
@@ -65,7 +65,7 @@ void CalcNodeVar( RealField & qNodeField, RealField & qField )
 {
     UnsGrid * grid = Zone::GetUnsGrid();
     FaceTopo * faceTopo = grid->faceTopo;
-    LinkField & f2c = faceTopo->faces;
+    CsrLink & f2c = faceTopo->faces;
 
     int nNodes = grid->nNodes;
     int nFaces = grid->nFaces;
@@ -107,7 +107,7 @@ void FixBcNodeVar( RealField & qNodeField, RealField & qField, RealField & nCoun
     UnsGrid * grid = Zone::GetUnsGrid();
     FaceTopo * faceTopo = grid->faceTopo;
     BcRecord * bcRecord = faceTopo->bcManager->bcRecord;
-    LinkField & f2c = faceTopo->faces;
+    CsrLink & f2c = faceTopo->faces;
 
     int nNodes = grid->nNodes;
     int nFaces = grid->nFaces;
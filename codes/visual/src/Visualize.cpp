@@ -112,6 +112,29 @@ void Plot::DumpFaceNodeNumber( LinkField & f2n )
     if ( nFaces % Plot::nWords == 0 ) ( * Plot::oss ) << std::endl;
 }
 
+void Plot::DumpFaceNodeNumber( CsrLink & f2n )
+{
+    int nFaces = f2n.size();
+    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    {
+        ( * Plot::oss ) << f2n.RowSize( iFace ) << " ";
+        if ( ( iFace + 1 ) % Plot::nWords == 0 ) ( * Plot::oss ) << std::endl;
+    }
+    if ( nFaces % Plot::nWords == 0 ) ( * Plot::oss ) << std::endl;
+}
+
+//the rows are stored back to back, so the node list is written in one pass
+void Plot::DumpFaceNodeLink( CsrLink & f2n )
+{
+    int nNodes = f2n.data.size();
+    for ( int iNode = 0; iNode < nNodes; ++ iNode )
+    {
+        ( * Plot::oss ) << f2n.data[ iNode ] + 1 << " ";
+        if ( ( iNode + 1 ) % Plot::nWords == 0 ) ( * Plot::oss ) << std::endl;
+    }
+    if ( nNodes % Plot::nWords != 0 ) ( * Plot::oss ) << std::endl;
+}
+
 int GetTotalNumFaceNodes( LinkField & f2n )
 {
     int totalNumFaceNodes = 0;
@@ -0,0 +1,248 @@
+/*---------------------------------------------------------------------------*\
+    OneFLOW - LargeScale Multiphysics Scientific Simulation Environment
+    Copyright (C) 2017-2023 He Xin and the OneFLOW contributors.
+-------------------------------------------------------------------------------
+License
+    This file is part of OneFLOW.
+
+    OneFLOW is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OneFLOW is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "VtkFile.h"
+#include <algorithm>
+
+
+BeginNameSpace( ONEFLOW )
+
+const int VTK_POLYGON    = 7;
+const int VTK_POLYHEDRON = 42;
+
+template < typename T >
+void WriteVtkBlock( std::fstream & file, const T * data, HXLongLong_t nElements )
+{
+    //header_type="UInt64": every appended block starts with its byte count
+    unsigned long long nBytes = sizeof( T ) * nElements;
+    file.write( reinterpret_cast< const char * >( & nBytes ), sizeof( nBytes ) );
+    if ( nBytes > 0 )
+    {
+        file.write( reinterpret_cast< const char * >( data ), nBytes );
+    }
+}
+
+HXLongLong_t GetVtkBlockSize( HXLongLong_t nBytes )
+{
+    return sizeof( unsigned long long ) + nBytes;
+}
+
+std::string GetVtkByteOrder()
+{
+    int one = 1;
+    if ( * reinterpret_cast< char * >( & one ) == 1 ) return "LittleEndian";
+    return "BigEndian";
+}
+
+std::string GetVtkRealType()
+{
+    if ( sizeof( Real ) == 8 ) return "Float64";
+    return "Float32";
+}
+
+VtkFile::VtkFile()
+{
+    l2g = 0;
+}
+
+VtkFile::~VtkFile()
+{
+    ;
+}
+
+void VtkFile::SetPoints( RealField & x, RealField & y, RealField & z, IntField * l2g )
+{
+    this->l2g = l2g;
+
+    int nPoints = l2g ? l2g->size() : x.size();
+    points.resize( 3 * nPoints );
+
+    for ( int iPoint = 0; iPoint < nPoints; ++ iPoint )
+    {
+        int id = l2g ? ( * l2g )[ iPoint ] : iPoint;
+        points[ 3 * iPoint     ] = x[ id ];
+        points[ 3 * iPoint + 1 ] = y[ id ];
+        points[ 3 * iPoint + 2 ] = z[ id ];
+    }
+}
+
+void VtkFile::AddPolygon( IntField & nodes )
+{
+    int nNodes = nodes.size();
+    for ( int iNode = 0; iNode < nNodes; ++ iNode )
+    {
+        connectivity.push_back( nodes[ iNode ] );
+    }
+    offsets.push_back( connectivity.size() );
+    types.push_back( VTK_POLYGON );
+    faceOffsets.push_back( -1 );
+}
+
+void VtkFile::AddPolyhedron( LinkField & cellFaces )
+{
+    IntField cellNodes;
+
+    int nFaces = cellFaces.size();
+    faces.push_back( nFaces );
+    for ( int iFace = 0; iFace < nFaces; ++ iFace )
+    {
+        int nNodes = cellFaces[ iFace ].size();
+        faces.push_back( nNodes );
+        for ( int iNode = 0; iNode < nNodes; ++ iNode )
+        {
+            faces.push_back( cellFaces[ iFace ][ iNode ] );
+            cellNodes.push_back( cellFaces[ iFace ][ iNode ] );
+        }
+    }
+
+    std::sort( cellNodes.begin(), cellNodes.end() );
+    cellNodes.erase( std::unique( cellNodes.begin(), cellNodes.end() ), cellNodes.end() );
+
+    int nNodes = cellNodes.size();
+    for ( int iNode = 0; iNode < nNodes; ++ iNode )
+    {
+        connectivity.push_back( cellNodes[ iNode ] );
+    }
+    offsets.push_back( connectivity.size() );
+    types.push_back( VTK_POLYHEDRON );
+    faceOffsets.push_back( faces.size() );
+}
+
+void VtkFile::AddPointField( RealField & q, const std::string & varName )
+{
+    varNames.push_back( varName );
+    varFields.push_back( & q );
+}
+
+void VtkFile::Write( std::fstream & file )
+{
+    int nPoints = points.size() / 3;
+    int nCells = types.size();
+    int nVar = varFields.size();
+    bool polyhedron = ! faces.empty();
+
+    std::string realType = GetVtkRealType();
+
+    HXLongLong_t offset = 0;
+
+    std::ostringstream oss;
+    oss << "<?xml version=\"1.0\"?>\n";
+    oss << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << GetVtkByteOrder() << "\" header_type=\"UInt64\">\n";
+    oss << "  <UnstructuredGrid>\n";
+    oss << "    <Piece NumberOfPoints=\"" << nPoints << "\" NumberOfCells=\"" << nCells << "\">\n";
+
+    oss << "      <PointData>\n";
+    for ( int iVar = 0; iVar < nVar; ++ iVar )
+    {
+        oss << "        <DataArray type=\"" << realType << "\" Name=\"" << varNames[ iVar ] << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += GetVtkBlockSize( sizeof( Real ) * nPoints );
+    }
+    oss << "      </PointData>\n";
+
+    oss << "      <Points>\n";
+    oss << "        <DataArray type=\"" << realType << "\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+    offset += GetVtkBlockSize( sizeof( Real ) * points.size() );
+    oss << "      </Points>\n";
+
+    oss << "      <Cells>\n";
+    oss << "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+    offset += GetVtkBlockSize( sizeof( int ) * connectivity.size() );
+    oss << "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+    offset += GetVtkBlockSize( sizeof( int ) * offsets.size() );
+    oss << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+    offset += GetVtkBlockSize( sizeof( unsigned char ) * types.size() );
+    if ( polyhedron )
+    {
+        oss << "        <DataArray type=\"Int32\" Name=\"faces\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += GetVtkBlockSize( sizeof( int ) * faces.size() );
+        oss << "        <DataArray type=\"Int32\" Name=\"faceoffsets\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += GetVtkBlockSize( sizeof( int ) * faceOffsets.size() );
+    }
+    oss << "      </Cells>\n";
+
+    oss << "    </Piece>\n";
+    oss << "  </UnstructuredGrid>\n";
+    oss << "  <AppendedData encoding=\"raw\">\n";
+    oss << "_";
+
+    std::string header = oss.str();
+    file.write( header.c_str(), header.size() );
+
+    //node fields of a boundary piece are gathered through its local to global node map
+    RealField q;
+    for ( int iVar = 0; iVar < nVar; ++ iVar )
+    {
+        RealField & field = * varFields[ iVar ];
+        if ( l2g )
+        {
+            q.resize( nPoints );
+            for ( int iPoint = 0; iPoint < nPoints; ++ iPoint )
+            {
+                q[ iPoint ] = field[ ( * l2g )[ iPoint ] ];
+            }
+            WriteVtkBlock( file, q.data(), nPoints );
+        }
+        else
+        {
+            WriteVtkBlock( file, field.data(), nPoints );
+        }
+    }
+
+    WriteVtkBlock( file, points.data(), points.size() );
+    WriteVtkBlock( file, connectivity.data(), connectivity.size() );
+    WriteVtkBlock( file, offsets.data(), offsets.size() );
+    WriteVtkBlock( file, types.data(), types.size() );
+    if ( polyhedron )
+    {
+        WriteVtkBlock( file, faces.data(), faces.size() );
+        WriteVtkBlock( file, faceOffsets.data(), faceOffsets.size() );
+    }
+
+    std::string footer = "\n  </AppendedData>\n</VTKFile>\n";
+    file.write( footer.c_str(), footer.size() );
+}
+
+void VtkFile::DumpIndexHeader( std::ostringstream & oss )
+{
+    oss << "<?xml version=\"1.0\"?>\n";
+    oss << "<VTKFile type=\"vtkMultiBlockDataSet\" version=\"1.0\" byte_order=\"" << GetVtkByteOrder() << "\">\n";
+    oss << "  <vtkMultiBlockDataSet>\n";
+}
+
+void VtkFile::DumpIndexBlock( std::ostringstream & oss, int blockId, StringField & pieceNames, StringField & pieceFiles )
+{
+    oss << "    <Block index=\"" << blockId << "\" name=\"zone" << blockId << "\">\n";
+    int nPieces = pieceFiles.size();
+    for ( int iPiece = 0; iPiece < nPieces; ++ iPiece )
+    {
+        oss << "      <DataSet index=\"" << iPiece << "\" name=\"" << pieceNames[ iPiece ] << "\" file=\"" << pieceFiles[ iPiece ] << "\"/>\n";
+    }
+    oss << "    </Block>\n";
+}
+
+void VtkFile::DumpIndexFooter( std::ostringstream & oss )
+{
+    oss << "  </vtkMultiBlockDataSet>\n";
+    oss << "</VTKFile>\n";
+}
+
+EndNameSpace
@@ -40,12 +40,14 @@ public:
     static void PrepareFlowGrid();
     static void ProcessWallDist();
     static void ProcessFlowWallDist();
+    static void UpdateFlowWallDist();
     static void AllocWallDist();
 };
 
 std::string GetGridFileName();
 void WalldistSimu();
 void CreateWallDist();
+void UpdateWallDist();
 void LoadWallDist();
 
 EndNameSpace
@@ -28,6 +28,7 @@ along with OneFLOW.  If not, see <http://www.gnu.org/licenses/>.
 #include "SimuDef.h"
 #include "WallDist.h"
 #include "CmxTask.h"
+#include "Iteration.h"
 #include "InterFace.h"
 #include "SlipFace.h"
 #include <iostream>
@@ -94,6 +95,16 @@ void MultiBlock::ProcessFlowWallDist()
     }
 }
 
+void MultiBlock::UpdateFlowWallDist()
+{
+    if ( vis_model.vismodel <= 1 ) return;
+    if ( ctrl.wdstupdate <= 0 ) return;
+    if ( Iteration::outerSteps % ctrl.wdstupdate != 0 ) return;
+
+    //the mesh motion of this step has already moved the nodes and recomputed the metrics
+    UpdateWallDist();
+}
+
 void MultiBlock::ProcessWallDist()
 {
     AllocWallDist();
@@ -105,10 +116,22 @@ void CreateWallDist()
     SolverState::tid = GRID_SOLVER;
     SsSgTask( "FILL_WALL_STRUCT" );
     SsSgTask( "CALC_WALL_DIST" );
-    FreeWallStruct();
+    //moving walls keep the search structure and the nearest faces for UpdateWallDist
+    if ( ctrl.wdstupdate <= 0 )
+    {
+        FreeWallStruct();
+    }
     SsSgTask( "WRITE_WALL_DIST" );
 }
 
+void UpdateWallDist()
+{
+    //for moved walls: the cell centres and face metrics must be current, the wall search structure is kept
+    SolverState::tid = GRID_SOLVER;
+    SsSgTask( "FILL_WALL_STRUCT" );
+    SsSgTask( "CALC_WALL_DIST" );
+}
+
 void LoadWallDist()
 {
     SolverState::tid = GRID_SOLVER;